@@ -0,0 +1,33 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+from typing import ClassVar
+
+import scipp as sc
+from scipp.serialization import deserialize, serialize
+
+
+class Serialization:
+    """
+    Benchmark round trips through the serialization used by dask/distributed.
+    """
+
+    params: ClassVar[tuple[list[int], list[bool]]] = (
+        [10**3, 10**6, 10**7],
+        [False, True],
+    )
+    param_names: ClassVar[list[str]] = ['nevent', 'binned']
+
+    def setup(self, nevent: int, binned: bool) -> None:
+        self.da = sc.data.table_xyz(nevent)
+        if binned:
+            self.da = self.da.bin(x=100)
+        self.header, self.frames = serialize(self.da)
+
+    def time_serialize(self, nevent: int, binned: bool) -> None:
+        serialize(self.da)
+
+    def time_deserialize(self, nevent: int, binned: bool) -> None:
+        deserialize(self.header, self.frames)
+
+    def time_roundtrip(self, nevent: int, binned: bool) -> None:
+        deserialize(*serialize(self.da))
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 
 #include "scipp/variable/accumulate.h"
+#include "scipp/variable/reduction.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -53,4 +54,59 @@ BENCHMARK(BM_accumulate_in_place)
     ->RangeMultiplier(2)
     ->Ranges({{2, 2ul << 25ul}, {false, true}, {false, true}});
 
+/// Reduce the inner dim of (bank, pixel, tof) data with few banks, which
+/// requires partitioning more than the outer dim of the output for threading.
+static void BM_accumulate_3d_inner(benchmark::State &state) {
+  const auto n = 2ul << 25ul;
+  const auto nbank = state.range(0);
+  const auto ntof = state.range(1);
+  const auto npixel = n / (nbank * ntof);
+  const auto b = makeBenchmarkVariable(
+      Dimensions{{Dim::X, nbank}, {Dim::Y, npixel}, {Dim::Z, ntof}}, false);
+  auto a = copy(b.slice({Dim::Z, 0}));
+  static constexpr auto op{[](auto &a_, const auto &b_) { a_ += b_; }};
+
+  for ([[maybe_unused]] auto _ : state) {
+    accumulate_in_place<Types>(a, b, op, "");
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+  state.counters["n_bank"] = nbank;
+  state.counters["n_pixel"] = npixel;
+  state.counters["n_tof"] = ntof;
+}
+
+BENCHMARK(BM_accumulate_3d_inner)
+    ->Args({1, 1000})
+    ->Args({2, 1000})
+    ->Args({4, 100})
+    ->Args({2, 10})
+    ->Args({8, 100000});
+
+/// Sum uses pairwise summation, compare to BM_accumulate_in_place with naive
+/// summation.
+static void BM_sum(benchmark::State &state) {
+  const auto n = 2ul << 26ul;
+  const auto nx = state.range(0);
+  const auto ny = n / nx;
+  const bool outer = state.range(1);
+  const auto b =
+      makeBenchmarkVariable(Dimensions{{Dim::X, nx}, {Dim::Y, ny}}, false);
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(sum(b, outer ? Dim::X : Dim::Y));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+  state.counters["n_outer"] = nx;
+  state.counters["n_inner"] = ny;
+  state.counters["sum-outer"] = outer;
+}
+
+BENCHMARK(BM_sum)
+    ->RangeMultiplier(64)
+    ->Ranges({{2, 2ul << 25ul}, {false, true}});
+
 BENCHMARK_MAIN();
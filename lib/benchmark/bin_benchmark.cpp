@@ -3,6 +3,7 @@
 /// @file
 #include <benchmark/benchmark.h>
 
+#include "scipp/core/scratch_buffer.h"
 #include "scipp/dataset/bin.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/operations.h"
@@ -41,10 +42,33 @@ static void BM_bin_table(benchmark::State &state) {
   state.counters["xbins"] = nx;
   state.counters["ybins"] = edges_y.dims().volume() - 1;
   state.counters["events"] = nEvent;
+  state.counters["scratch_bytes"] = benchmark::Counter(
+      static_cast<double>(core::scratch::allocated_bytes()),
+      benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
 }
 BENCHMARK(BM_bin_table)
     ->RangeMultiplier(10)
-    ->Ranges({{10, 2ul << 19ul}, {2ul << 16ul, 2ul << 15ul}});
+    ->Ranges({{10, 2ul << 19ul}, {2ul << 15ul, 2ul << 16ul}});
+
+// Sweep number of output bins across the crossover point between single and
+// two-pass mapping of events to bins.
+static void BM_bin_table_many_bins(benchmark::State &state) {
+  const scipp::index nx = state.range(0);
+  const scipp::index nEvent = state.range(1);
+  auto table = make_table(nEvent);
+  auto edges_x = make_edges(Dim::X, nx);
+
+  for (auto _ : state) {
+    // cppcheck-suppress unreadVariable
+    auto a = dataset::bin(table, {edges_x});
+  }
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.counters["xbins"] = nx;
+  state.counters["events"] = nEvent;
+}
+BENCHMARK(BM_bin_table_many_bins)
+    ->RangeMultiplier(4)
+    ->Ranges({{1 << 12, 1 << 24}, {1 << 24, 1 << 24}});
 
 static void BM_rebin_outer(benchmark::State &state) {
   const scipp::index nx = state.range(0);
@@ -63,10 +87,39 @@ static void BM_rebin_outer(benchmark::State &state) {
   state.counters["xbins"] = nx;
   state.counters["ybins"] = edges_y.dims().volume() - 1;
   state.counters["events"] = nEvent;
+  state.counters["scratch_bytes"] = benchmark::Counter(
+      static_cast<double>(core::scratch::allocated_bytes()),
+      benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
 }
 BENCHMARK(BM_rebin_outer)
     ->RangeMultiplier(10)
     ->Ranges({{10, static_cast<int64_t>(1e6)},
               {static_cast<int64_t>(1e5), static_cast<int64_t>(1e8)}});
 
+// Rebin data with many input bins along the rebinned dim. Each input bin maps
+// to few output bins, so this is dominated by the SubbinSizes bookkeeping for
+// small event counts.
+static void BM_rebin_many_input_bins(benchmark::State &state) {
+  const scipp::index nx = state.range(0);
+  const scipp::index nInput = state.range(1);
+  const scipp::index nEvent = 4 * nInput;
+  auto table = make_table(nEvent);
+  auto edges_x = make_edges(Dim::X, nx);
+
+  auto binned = dataset::bin(table, {make_edges(Dim::X, nInput)});
+
+  for (auto _ : state) {
+    // cppcheck-suppress unreadVariable
+    auto a = dataset::bin(binned, {edges_x});
+  }
+  state.SetItemsProcessed(state.iterations() * nInput);
+  state.counters["xbins"] = nx;
+  state.counters["input_bins"] = nInput;
+  state.counters["events"] = nEvent;
+}
+BENCHMARK(BM_rebin_many_input_bins)
+    ->RangeMultiplier(10)
+    ->Ranges({{10, static_cast<int64_t>(1e5)},
+              {static_cast<int64_t>(1e4), static_cast<int64_t>(1e6)}});
+
 BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/shape.h"
+#include "scipp/dataset/sort.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/operations.h"
 
@@ -77,4 +78,29 @@ static void BM_bucketby(benchmark::State &state) {
 }
 BENCHMARK(BM_bucketby)->RangeMultiplier(4)->Ranges({{64, 2ul << 23ul}});
 
+// Sweep from many small bins to a few bins that exceed the threshold for
+// sorting a single bin in parallel.
+static void BM_buckets_sort(benchmark::State &state) {
+  const scipp::index nBin = state.range(0);
+  const scipp::index nEvent = state.range(1);
+  auto table = make_table(nEvent);
+  auto edges_x = makeVariable<double>(Dims{Dim::X}, Shape{nBin + 1});
+  auto edges = edges_x.values<double>();
+  for (scipp::index i = 0; i <= nBin; ++i)
+    edges[i] = -2.0 + 4.0 * static_cast<double>(i) / static_cast<double>(nBin);
+  const auto binned = dataset::bin(table, {edges_x});
+
+  for (auto _ : state) {
+    // cppcheck-suppress unreadVariable
+    auto a = dataset::buckets::sort(binned, Dim::Y);
+  }
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.counters["events"] = nEvent;
+  state.counters["buckets"] = nBin;
+}
+BENCHMARK(BM_buckets_sort)
+    ->RangeMultiplier(8)
+    ->Ranges({{1, 2ul << 18ul}, {2ul << 22ul, 2ul << 22ul}})
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
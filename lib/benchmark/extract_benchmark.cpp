@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/dataset/extract.h"
+#include "scipp/variable/take.h"
+
+using namespace scipp;
+
+namespace {
+auto make_table(const scipp::index size) {
+  const auto data = makeVariable<double>(Dims{Dim::X}, Shape{size},
+                                         sc_units::counts, Values{},
+                                         Variances{});
+  const auto coord = makeVariable<double>(Dims{Dim::X}, Shape{size});
+  return DataArray(data, {{Dim::X, coord}, {Dim::Y, coord}},
+                   {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{size})}});
+}
+
+auto make_binned(const scipp::index size, const scipp::index bin_size) {
+  auto indices = makeVariable<scipp::index_pair>(Dims{Dim::X}, Shape{size});
+  scipp::index current = 0;
+  for (auto &range : indices.values<scipp::index_pair>()) {
+    range = {current, current + bin_size};
+    current += bin_size;
+  }
+  auto buffer = make_table(size * bin_size);
+  buffer.coords().erase(Dim::Y);
+  buffer.masks().erase("mask");
+  return DataArray(
+      dataset::make_bins(std::move(indices), Dim::X, std::move(buffer)));
+}
+
+/// Random condition with approximately `percent` percent true elements.
+auto make_condition(const scipp::index size, const int64_t percent) {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int64_t> dist(0, 99);
+  auto condition = makeVariable<bool>(Dims{Dim::X}, Shape{size});
+  for (auto &&c : condition.values<bool>())
+    c = dist(rng) < percent;
+  return condition;
+}
+
+auto make_indices(const scipp::index size) {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int64_t> dist(0, size - 1);
+  auto indices = makeVariable<int64_t>(Dims{Dim::X}, Shape{size});
+  for (auto &i : indices.values<int64_t>())
+    i = dist(rng);
+  return indices;
+}
+} // namespace
+
+// Sweep over the fraction of selected rows. Data, variances, two coords, and a
+// mask are gathered.
+static void BM_extract_dense(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  const auto percent = state.range(1);
+  const auto table = make_table(size);
+  const auto condition = make_condition(size, percent);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(extract(table, condition));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.counters["percent"] = static_cast<double>(percent);
+}
+BENCHMARK(BM_extract_dense)
+    ->ArgsProduct({{1 << 12, 1 << 20, 1 << 24}, {1, 10, 50, 90, 100}})
+    ->UseRealTime();
+
+static void BM_extract_binned(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  const auto percent = state.range(1);
+  const auto binned = make_binned(size, 100);
+  const auto condition = make_condition(size, percent);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(extract(binned, condition));
+  }
+  state.SetItemsProcessed(state.iterations() * size * 100);
+  state.counters["percent"] = static_cast<double>(percent);
+}
+BENCHMARK(BM_extract_binned)
+    ->ArgsProduct({{1 << 10, 1 << 16}, {1, 10, 50, 90, 100}})
+    ->UseRealTime();
+
+// Random permutation-like access, e.g., from `sort` or fancy indexing.
+static void BM_take_random(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  const auto table = make_table(size);
+  const auto indices = make_indices(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(variable::take(table.data(), indices, Dim::X));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * size * 2 * sizeof(double) * 2);
+}
+BENCHMARK(BM_take_random)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 24)
+    ->UseRealTime();
+
+// Gathering bins of binned data only remaps the bin indices.
+static void BM_take_binned(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  const auto binned = make_binned(size, 100);
+  const auto indices = make_indices(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(variable::take(binned.data(), indices, Dim::X));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_take_binned)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -111,4 +111,46 @@ static void BM_groupby_large_table(benchmark::State &state) {
 
 BENCHMARK(BM_groupby_large_table)->RangeMultiplier(2)->Range(64, 2 << 20);
 
+/// Group rows with unsorted keys, such as detector IDs, where nearly every row
+/// starts a new contiguous run of equal keys.
+static void BM_groupby_unsorted(benchmark::State &state) {
+  const scipp::index nRow = 2 << 19;
+  const scipp::index nGroup = state.range(0);
+  const bool use_variances = state.range(1);
+  const scipp::index nInner = state.range(2);
+  std::vector<int64_t> group_(nRow);
+  for (scipp::index i = 0; i < nRow; ++i)
+    group_[i] = (i * 7919) % nGroup;
+  const Dimensions dims = nInner == 1
+                              ? Dimensions{Dim::X, nRow}
+                              : Dimensions{{Dim::X, nRow}, {Dim::Y, nInner}};
+  DataArray da(use_variances
+                   ? makeVariable<double>(dims, Values{}, Variances{})
+                   : makeVariable<double>(dims));
+  da.coords().set(Dim("group"),
+                  makeVariable<int64_t>(Dims{Dim::X}, Shape{nRow},
+                                        Values(group_.begin(), group_.end())));
+  for (auto _ : state) {
+    auto grouped = groupby(da, Dim("group")).sum(Dim::X);
+    state.PauseTiming();
+    // cppcheck-suppress redundantInitialization  # Used to modify shared_ptr.
+    // cppcheck-suppress unreadVariable
+    grouped = DataArray();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nRow * nInner);
+  state.counters["groups"] = nGroup;
+  state.counters["variances"] = use_variances;
+  state.counters["inner"] = nInner;
+}
+
+BENCHMARK(BM_groupby_unsorted)
+    ->Args({64, false, 1})
+    ->Args({4096, false, 1})
+    ->Args({262144, false, 1})
+    ->Args({524288, false, 1})
+    ->Args({4096, true, 1})
+    ->Args({64, false, 16})
+    ->Args({4096, false, 16});
+
 BENCHMARK_MAIN();
@@ -61,4 +61,39 @@ BENCHMARK(BM_histogram)
     ->RangeMultiplier(2)
     ->Ranges({{64, 2 << 14}, {128, 2 << 11}, {false, true}});
 
+// Histogram a single large list of events, e.g., a spectrum summed over all
+// pixels. Parallelism comes only from splitting the list.
+static void BM_histogram_single_list(benchmark::State &state) {
+  const scipp::index nEvent = state.range(0);
+  const scipp::index nEdge = state.range(1);
+  const bool linear = state.range(2);
+  Random rand(0.0, 1000.0);
+  auto y = makeVariable<double>(Dims{Dim::Event}, Shape{nEvent},
+                                Values(rand(nEvent)));
+  const DataArray events(makeVariable<double>(Dims{Dim::Event}, Shape{nEvent},
+                                              Values{}, Variances{}),
+                         {{Dim::Y, y}});
+  std::vector<double> edges_(nEdge);
+  std::iota(edges_.begin(), edges_.end(), 0.0);
+  if (!linear)
+    edges_.back() += 0.0001;
+  auto edges = makeVariable<double>(Dims{Dim::Y}, Shape{nEdge},
+                                    Values(edges_.begin(), edges_.end()));
+  edges *= 1000.0 / nEdge * sc_units::one; // ensure all events are in range
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(histogram(events, edges));
+  }
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.SetBytesProcessed(state.iterations() * 3 * nEvent * sizeof(double));
+  state.counters["const-width-bins"] = linear;
+}
+
+// Params are:
+// - nEvent
+// - nEdge
+// - constant-width-bins
+BENCHMARK(BM_histogram_single_list)
+    ->RangeMultiplier(16)
+    ->Ranges({{1 << 16, 1 << 26}, {128, 2 << 15}, {false, true}});
+
 BENCHMARK_MAIN();
@@ -35,4 +35,56 @@ static void BM_MultiIndex(benchmark::State &state) {
 }
 BENCHMARK(BM_MultiIndex);
 
+namespace {
+enum class Layout { Contiguous, Transposed, Sliced };
+
+/// Index for the two operands of an in-place operation iterating `dims`.
+MultiIndex<2> make_index(const Dimensions &dims, const Layout layout) {
+  const auto nz = dims[Dim::Z];
+  const auto ny = dims[Dim::Y];
+  const auto nx = dims[Dim::X];
+  switch (layout) {
+  case Layout::Transposed: {
+    // Both operands are transposed views, e.g., `transpose(a) *= 2.0`.
+    const Strides strides{1, nz, nz * ny};
+    return MultiIndex(dims, strides, strides);
+  }
+  case Layout::Sliced: {
+    // Both operands are slices of the first half of Dim::Y.
+    const Strides strides{2 * ny * nx, nx, 1};
+    return MultiIndex(dims, strides, strides);
+  }
+  default:
+    return MultiIndex(dims, Strides(dims), Strides(dims));
+  }
+}
+} // namespace
+
+// Iterate like transform, i.e., in chunks of the inner dimension. Merging and
+// reordering dims in MultiIndex yields long inner loops for all layouts.
+static void BM_MultiIndex_inner_loop(benchmark::State &state) {
+  const auto layout = static_cast<Layout>(state.range(0));
+  const auto nx = state.range(1);
+  const Dimensions dims{{Dim::Z, Dim::Y, Dim::X}, {64, 1024 * 16 / nx, nx}};
+  const auto begin = make_index(dims, layout);
+  const auto end = begin.end();
+
+  scipp::index result{0};
+  for (auto _ : state) {
+    for (auto it = begin; it != end;) {
+      const auto n = it.inner_distance_to_end();
+      const auto [i0, i1] = it.get();
+      const auto strides = it.inner_strides();
+      for (scipp::index i = 0; i < n; ++i)
+        result += (i0 + i * strides[0]) - (i1 + i * strides[1]);
+      it.increment_by(n);
+    }
+  }
+  benchmark::DoNotOptimize(result);
+  state.SetItemsProcessed(state.iterations() * dims.volume());
+}
+BENCHMARK(BM_MultiIndex_inner_loop)
+    ->ArgNames({"layout", "nx"})
+    ->ArgsProduct({{0, 1, 2}, {4, 64, 1024}});
+
 BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <benchmark/benchmark.h>
+
+#include "scipp/variable/rebin.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/variable_factory.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+namespace {
+Variable make_edges(const scipp::index nbin) {
+  std::vector<double> edges(nbin + 1);
+  for (scipp::index i = 0; i <= nbin; ++i)
+    edges[i] = static_cast<double>(i) / nbin;
+  return makeVariable<double>(Dims{Dim::X}, Shape{nbin + 1}, sc_units::us,
+                              Values(edges.begin(), edges.end()));
+}
+} // namespace
+
+/// Rebin (x, y) data along x, i.e., the outer dim, as for (tof, pixel) data.
+static void BM_rebin_outer(benchmark::State &state) {
+  const scipp::index n_old = state.range(0);
+  const scipp::index n_new = state.range(1);
+  const scipp::index n_pixel = state.range(2);
+  const bool use_variances = state.range(3);
+  const Dimensions dims{{Dim::X, n_old}, {Dim::Y, n_pixel}};
+  const auto var = use_variances
+                       ? makeVariable<double>(dims, Values{}, Variances{})
+                       : makeVariable<double>(dims);
+  const auto old_edges = make_edges(n_old);
+  // Shift new edges so most new bins overlap partially with old bins.
+  const auto new_edges =
+      make_edges(n_new) * (0.999 * sc_units::one) + 0.0005 * sc_units::us;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(rebin(var, Dim::X, old_edges, new_edges));
+  }
+  const scipp::index variance_factor = use_variances ? 2 : 1;
+  state.SetItemsProcessed(state.iterations() * n_old * n_pixel *
+                          variance_factor);
+  state.SetBytesProcessed(state.iterations() * n_old * n_pixel *
+                          variance_factor * sizeof(double));
+  state.counters["n_old"] = n_old;
+  state.counters["n_new"] = n_new;
+  state.counters["n_pixel"] = n_pixel;
+  state.counters["variances"] = use_variances;
+}
+
+BENCHMARK(BM_rebin_outer)
+    ->Args({10000, 1000, 1000, false})
+    ->Args({10000, 10000, 1000, false})
+    ->Args({10000, 10000, 1000, true})
+    ->Args({100000, 10000, 100, false})
+    ->Args({1000, 100, 100000, false});
+
+/// Rebin (y, x) data along x, i.e., the inner dim, for comparison.
+static void BM_rebin_inner(benchmark::State &state) {
+  const scipp::index n_old = state.range(0);
+  const scipp::index n_new = state.range(1);
+  const scipp::index n_pixel = state.range(2);
+  const bool use_variances = state.range(3);
+  const Dimensions dims{{Dim::Y, n_pixel}, {Dim::X, n_old}};
+  const auto var = use_variances
+                       ? makeVariable<double>(dims, Values{}, Variances{})
+                       : makeVariable<double>(dims);
+  const auto old_edges = make_edges(n_old);
+  const auto new_edges =
+      make_edges(n_new) * (0.999 * sc_units::one) + 0.0005 * sc_units::us;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(rebin(var, Dim::X, old_edges, new_edges));
+  }
+  const scipp::index variance_factor = use_variances ? 2 : 1;
+  state.SetItemsProcessed(state.iterations() * n_old * n_pixel *
+                          variance_factor);
+  state.SetBytesProcessed(state.iterations() * n_old * n_pixel *
+                          variance_factor * sizeof(double));
+  state.counters["n_old"] = n_old;
+  state.counters["n_new"] = n_new;
+  state.counters["n_pixel"] = n_pixel;
+  state.counters["variances"] = use_variances;
+}
+
+BENCHMARK(BM_rebin_inner)
+    ->Args({10000, 1000, 1000, false})
+    ->Args({10000, 10000, 1000, false})
+    ->Args({10000, 10000, 1000, true})
+    ->Args({100000, 10000, 100, false})
+    ->Args({1000, 100, 100000, false});
+
+BENCHMARK_MAIN();
@@ -6,7 +6,11 @@
 
 #include <random>
 
+#include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/comparison.h"
+#include "scipp/variable/lazy.h"
+#include "scipp/variable/math.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable.h"
 
@@ -282,4 +286,90 @@ static void BM_transform_buckets_inplace_unary(benchmark::State &state) {
 
 BENCHMARK(BM_transform_buckets_inplace_unary);
 
+// Arguments are:
+// range(0) -> ny
+// range(1) -> variances false/true
+// range(2) -> eager/lazy
+static void BM_transform_fused_chain(benchmark::State &state) {
+  const auto nx = 100;
+  const auto ny = state.range(0);
+  const auto n = nx * ny;
+  const bool variances = state.range(1);
+  const bool lazy = state.range(2);
+  const Dimensions dims{{Dim::Y, ny}, {Dim::X, nx}};
+  const auto a = makeBenchmarkVariable(dims, variances);
+  const auto b = makeBenchmarkVariable(dims, variances);
+  const auto c = makeBenchmarkVariable(dims, false);
+  const auto d = makeVariable<double>(Values{2.0});
+
+  for (auto _ : state) {
+    if (lazy)
+      benchmark::DoNotOptimize(lazy::eval((lazy::expr(a) - b) * c / d));
+    else
+      benchmark::DoNotOptimize((a - b) * c / d);
+  }
+
+  const scipp::index variance_factor = variances ? 2 : 1;
+  state.SetItemsProcessed(state.iterations() * n * variance_factor);
+  state.counters["n"] = n;
+  state.counters["variances"] = variances;
+  state.counters["lazy"] = lazy;
+}
+
+BENCHMARK(BM_transform_fused_chain)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 2 << 16}, {false, true}, {false, true}});
+
+// Arguments are:
+// range(0) -> ny
+// range(1) -> variances false/true
+static void BM_transform_unary_math(benchmark::State &state) {
+  const auto nx = 100;
+  const auto ny = state.range(0);
+  const auto n = nx * ny;
+  const bool variances = state.range(1);
+  const auto a = makeBenchmarkVariable({{Dim::Y, ny}, {Dim::X, nx}}, variances);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sqrt(a));
+  }
+
+  const scipp::index variance_factor = variances ? 2 : 1;
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * variance_factor * 2 *
+                          sizeof(double));
+  state.counters["n"] = n;
+  state.counters["variances"] = variances;
+}
+
+BENCHMARK(BM_transform_unary_math)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 2 << 16}, {false, true}});
+
+// Arguments are:
+// range(0) -> ny
+// range(1) -> broadcast second operand along inner dim false/true
+static void BM_transform_comparison(benchmark::State &state) {
+  const auto nx = 100;
+  const auto ny = state.range(0);
+  const auto n = nx * ny;
+  const bool broadcast = state.range(1);
+  const auto a = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{ny, nx});
+  const auto b =
+      broadcast ? makeVariable<double>(Dims{Dim::Y}, Shape{ny})
+                : makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{ny, nx});
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(less(a, b));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.counters["n"] = n;
+  state.counters["broadcast"] = broadcast;
+}
+
+BENCHMARK(BM_transform_comparison)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 2 << 16}, {false, true}});
+
 BENCHMARK_MAIN();
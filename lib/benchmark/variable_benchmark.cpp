@@ -4,9 +4,16 @@
 /// @author Simon Heybrock
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+
 #include "variable_common.h"
 
+#include "scipp/core/memory_pool.h"
+#include "scipp/core/numa.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -217,4 +224,107 @@ static void BM_Variable_sin_deg(benchmark::State &state) {
 }
 BENCHMARK(BM_Variable_sin_deg);
 
+// Expressions like `a * b + c` allocate a full-size temporary per operation.
+// Compare the system allocator with the thread-local memory pool.
+static void BM_Variable_arithmetic_temporaries(benchmark::State &state) {
+  const auto size = state.range(0);
+  const bool use_pool = state.range(1);
+  core::memory_pool::set_enabled(use_pool);
+  core::memory_pool::reset_statistics();
+  const auto a = makeVariable<double>(Dims{Dim::X}, Shape{size});
+  const auto b = makeVariable<double>(Dims{Dim::X}, Shape{size});
+  const auto c = makeVariable<double>(Dims{Dim::X}, Shape{size});
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a * b + c);
+  }
+
+  const auto stats = core::memory_pool::statistics();
+  core::memory_pool::set_enabled(false);
+  constexpr auto read_write_factor = 5;
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * size *
+                          read_write_factor);
+  state.counters["SizeBytes"] = sizeof(double) * size;
+  state.counters["PoolHits"] = stats.hits;
+  state.counters["PoolHighWaterBytes"] = stats.high_water_mark;
+}
+
+BENCHMARK(BM_Variable_arithmetic_temporaries)
+    ->ArgNames({"size", "pool"})
+    ->ArgsProduct({{1 << 10, 1 << 16, 1 << 20, 1 << 23}, {false, true}});
+
+// Many small Variables as created when slicing and operating on many bins.
+static void BM_Variable_create_small(benchmark::State &state) {
+  const bool use_pool = state.range(0);
+  core::memory_pool::set_enabled(use_pool);
+  for (auto _ : state) {
+    for (scipp::index i = 0; i < 1000; ++i)
+      benchmark::DoNotOptimize(makeVariable<double>(Dims{Dim::X}, Shape{100}));
+  }
+  core::memory_pool::set_enabled(false);
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+
+BENCHMARK(BM_Variable_create_small)->ArgName("pool")->Arg(false)->Arg(true);
+
+// Large buffers that are allocated uninitialized and filled by a single thread,
+// e.g., when loading from file, land on a single memory node unless placed
+// explicitly. Has no effect on machines with a single memory node.
+static void BM_Variable_numa_placement(benchmark::State &state) {
+  const auto size = state.range(0);
+  const auto policy = static_cast<core::numa::Policy>(state.range(1));
+  core::numa::set_policy(policy);
+  const auto make = [size] {
+    auto var = empty(Dimensions{Dim::X, size}, sc_units::m, dtype<double>);
+    auto values = var.values<double>();
+    std::fill(values.begin(), values.end(), 1.0);
+    return var;
+  };
+  const auto a = make();
+  const auto b = make();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a * b);
+  }
+
+  core::numa::set_policy(core::numa::Policy::Default);
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * size * 3);
+  state.counters["SizeBytes"] = sizeof(double) * size;
+  state.counters["NumaNodes"] = core::numa::node_count();
+}
+
+BENCHMARK(BM_Variable_numa_placement)
+    ->ArgNames({"size", "policy"})
+    ->ArgsProduct({{1 << 20, 1 << 24, 1 << 27}, {0, 1, 2}})
+    ->UseRealTime();
+
+// Copy of a (time, x) array. Layout 0 is contiguous, 1 is a transposed
+// view, 2 is a transposed view of a slice, e.g., when converting from
+// time-outer to x-outer order as done by `concat` or `copy(transpose(...))`.
+static void BM_Variable_copy_layout(benchmark::State &state) {
+  const auto length = state.range(0);
+  const auto layout = state.range(1);
+  const auto parent_length = layout == 2 ? 2 * length : length;
+  const auto parent = makeVariable<double>(Dims{Dim::Time, Dim::X},
+                                           Shape{length, parent_length},
+                                           Values{}, Variances{});
+  const auto sliced = layout == 2 ? parent.slice({Dim::X, 0, length}) : parent;
+  const auto var = layout == 0 ? sliced : transpose(sliced);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(copy(var));
+  }
+  const auto size = length * length;
+  state.SetItemsProcessed(state.iterations() * size);
+  // Read and write values and variances.
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * size * 4);
+  state.counters["SizeBytes"] = sizeof(double) * size * 2;
+}
+
+BENCHMARK(BM_Variable_copy_layout)
+    ->ArgNames({"length", "layout"})
+    ->ArgsProduct({{64, 1024, 4096}, {0, 1, 2}})
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -218,14 +218,14 @@ scipp_function(
 )
 setup_scipp_category(bins)
 
-scipp_function("reduction" reduction sum SKIP_VARIABLE)
-scipp_function("reduction" reduction nansum SKIP_VARIABLE)
-scipp_function("reduction" reduction max SKIP_VARIABLE)
-scipp_function("reduction" reduction nanmax SKIP_VARIABLE)
-scipp_function("reduction" reduction min SKIP_VARIABLE)
-scipp_function("reduction" reduction nanmin SKIP_VARIABLE)
-scipp_function("reduction" reduction all SKIP_VARIABLE)
-scipp_function("reduction" reduction any SKIP_VARIABLE)
+scipp_function("reduction" reduction sum SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction nansum SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction max SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction nanmax SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction min SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction nanmin SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction all SKIP_VARIABLE OUT)
+scipp_function("reduction" reduction any SKIP_VARIABLE OUT)
 scipp_function("reduction" reduction mean SKIP_VARIABLE SKIP_DATASET)
 scipp_function("reduction" reduction nanmean SKIP_VARIABLE SKIP_DATASET)
 setup_scipp_category(reduction)
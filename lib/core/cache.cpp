@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#endif
+
+#include "scipp/core/cache.h"
+
+namespace scipp::core::cache {
+
+namespace {
+constexpr std::size_t default_l2_size = 512 * 1024;
+std::atomic<std::size_t> g_l2_size_override{0};
+
+#ifdef __linux__
+/// Parse sizes like "2048K" as given in /sys/devices/system/cpu.
+std::size_t read_sysfs_size(const char *path) {
+  std::ifstream file(path);
+  std::string text;
+  if (!(file >> text) || text.empty())
+    return 0;
+  std::size_t pos = 0;
+  std::size_t size = 0;
+  try {
+    size = std::stoul(text, &pos);
+  } catch (...) {
+    return 0;
+  }
+  if (pos < text.size()) {
+    if (text[pos] == 'K')
+      size *= 1024;
+    else if (text[pos] == 'M')
+      size *= 1024 * 1024;
+  }
+  return size;
+}
+#endif
+
+std::size_t query_l2_size() noexcept {
+  long size = 0;
+#ifdef __linux__
+#ifdef _SC_LEVEL2_CACHE_SIZE
+  size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+  // sysconf returns 0 on some architectures, e.g., aarch64.
+  if (size <= 0)
+    size = static_cast<long>(
+        read_sysfs_size("/sys/devices/system/cpu/cpu0/cache/index2/size"));
+#elif defined(__APPLE__)
+  int64_t value = 0;
+  std::size_t length = sizeof(value);
+  if (sysctlbyname("hw.l2cachesize", &value, &length, nullptr, 0) == 0)
+    size = static_cast<long>(value);
+#endif
+  return size > 0 ? static_cast<std::size_t>(size) : default_l2_size;
+}
+} // namespace
+
+std::size_t l2_size() noexcept {
+  if (const auto size = g_l2_size_override.load(std::memory_order_relaxed))
+    return size;
+  static const auto size = query_l2_size();
+  return size;
+}
+
+void set_l2_size(const std::size_t bytes) noexcept {
+  g_l2_size_override.store(bytes, std::memory_order_relaxed);
+}
+
+} // namespace scipp::core::cache
@@ -69,13 +69,20 @@ ElementArrayViewParams::overlaps(const ElementArrayViewParams &other) const {
     // making extra copies.
     return false;
   }
+  if (m_iterDims.volume() == 0 || other.m_iterDims.volume() == 0)
+    return false;
+  // For binned data offset and strides refer to the bin indices, not to the
+  // buffer, so we cannot tell which part of the buffer is accessed.
+  if (m_bucketParams || other.m_bucketParams)
+    return true;
   // Otherwise check for partial overlap.
   const auto [this_begin, this_end] = memory_bounds(
       m_iterDims.shape().begin(), m_iterDims.shape().end(), m_strides.begin());
   const auto [other_begin, other_end] =
       memory_bounds(other.m_iterDims.shape().begin(),
                     other.m_iterDims.shape().end(), other.m_strides.begin());
-  return ((this_begin < other_end) && (this_end > other_begin));
+  return ((m_offset + this_begin < other.m_offset + other_end) &&
+          (m_offset + this_end > other.m_offset + other_begin));
 }
 
 } // namespace scipp::core
@@ -8,23 +8,48 @@
 #pragma once
 
 #include <cassert>
-
-#include "scipp/core/memory_pool.h"
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
 
 namespace scipp::core {
+#ifdef _WIN32
+// https://stackoverflow.com/questions/33696092/whats-the-correct-replacement-for-posix-memalign-in-windows
+static int check_align(size_t align) {
+  for (size_t i = sizeof(void *); i != 0; i *= 2)
+    if (align == i)
+      return 0;
+  return EINVAL;
+}
+
+static int posix_memalign(void **ptr, size_t align, size_t size) {
+  if (check_align(align))
+    return EINVAL;
+
+  int saved_errno = errno;
+  void *p = _aligned_malloc(size, align);
+  if (p == NULL) {
+    errno = saved_errno;
+    return ENOMEM;
+  }
+
+  *ptr = p;
+  return 0;
+}
+#endif
 
 enum class Alignment : size_t {
   Normal = sizeof(void *),
   SSE = 16,
   AVX = 32,
+  CacheLine = 64,
 };
 
 namespace detail {
 void *allocate_aligned_memory(size_t align, size_t size);
 void deallocate_aligned_memory(void *ptr) noexcept;
 
-// #define USE_POOL
-
 template <typename T> constexpr bool is_power_of_two(T v) {
   return v && ((v & (v - 1)) == 0);
 }
@@ -37,28 +62,20 @@ inline void *allocate_aligned_memory(size_t align, size_t size) {
     return nullptr;
   }
 
-#ifdef USE_POOL
-  return instance().allocate(size);
-#else
   void *ptr = nullptr;
   int rc = posix_memalign(&ptr, align, size);
   if (rc != 0) {
     return nullptr;
   }
   return ptr;
-#endif
 }
 
 inline void deallocate_aligned_memory(void *ptr) noexcept {
-#ifdef USE_POOL
-  return instance().deallocate(ptr);
-#else
 #ifdef _WIN32
   return _aligned_free(ptr);
 #else
   return free(ptr);
 #endif
-#endif
 }
 } // namespace detail
 
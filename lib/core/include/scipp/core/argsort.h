@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scipp/common/index.h"
+#include "scipp/core/bucket.h"
+#include "scipp/core/flags.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/time_point.h"
+
+namespace scipp::core {
+
+namespace argsort_detail {
+
+template <class T>
+constexpr bool is_radix_sortable_v =
+    std::is_arithmetic_v<T> || std::is_same_v<T, time_point>;
+
+/// Map a key to an unsigned integer with the same ordering.
+///
+/// NaN is mapped to the largest value, i.e., it compares greater than all
+/// other values, as in `dataset::sort`. -0.0 is mapped to the same value as
+/// 0.0 since the two compare equal.
+template <class T> auto radix_key(const T x) noexcept {
+  if constexpr (std::is_same_v<T, time_point>) {
+    return radix_key(x.time_since_epoch());
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<uint8_t>(x);
+  } else if constexpr (std::is_unsigned_v<T>) {
+    return x;
+  } else if constexpr (std::is_integral_v<T>) {
+    using U = std::make_unsigned_t<T>;
+    constexpr auto sign = U{1} << (8 * sizeof(U) - 1);
+    return static_cast<U>(static_cast<U>(x) ^ sign);
+  } else {
+    using U = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    constexpr auto sign = U{1} << (8 * sizeof(U) - 1);
+    if (std::isnan(x))
+      return ~U{0};
+    const auto bits = std::bit_cast<U>(x == T{0} ? T{0} : x);
+    return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+  }
+}
+
+constexpr int radix_bits = 11;
+constexpr scipp::index radix_size = scipp::index{1} << radix_bits;
+/// Inputs shorter than this are sorted using a comparison sort.
+constexpr scipp::index min_radix_sort_size = 2048;
+/// Number of keys per chunk, each chunk computes a private digit histogram.
+constexpr scipp::index radix_chunk_size = 65536;
+
+/// Stable least-significant-digit radix sort of `keys`, permuting `index`
+/// accordingly.
+///
+/// Every pass counts digits of chunks in parallel, followed by a parallel
+/// scatter. The offset of every (chunk, digit) pair is given by an exclusive
+/// scan over digits and chunks, which makes the scatter stable. Passes where
+/// all keys have the same digit are skipped. Passes alternate between the input
+/// and the scratch buffers `keys_out` and `index_out`, which must have the same
+/// size as the input. The content of `keys` is undefined on return.
+template <class U>
+void radix_sort(std::span<U> keys, std::span<scipp::index> index,
+                std::span<U> keys_out, std::span<scipp::index> index_out) {
+  const auto size = scipp::size(keys);
+  const auto n_chunk = (size + radix_chunk_size - 1) / radix_chunk_size;
+  const auto chunk_range = [size](const scipp::index chunk) {
+    return std::pair{chunk * radix_chunk_size,
+                     std::min(size, (chunk + 1) * radix_chunk_size)};
+  };
+  std::vector<std::array<scipp::index, radix_size>> offsets(n_chunk);
+  const auto result = index;
+  for (int shift = 0; shift < static_cast<int>(8 * sizeof(U));
+       shift += radix_bits) {
+    const auto digit = [shift](const U key) {
+      return static_cast<scipp::index>((key >> shift) & (radix_size - 1));
+    };
+    parallel::parallel_for(
+        parallel::blocked_range(0, n_chunk, 1), [&](const auto &range) {
+          for (scipp::index chunk = range.begin(); chunk < range.end();
+               ++chunk) {
+            auto &count = offsets[chunk];
+            count.fill(0);
+            const auto [begin, end] = chunk_range(chunk);
+            for (scipp::index i = begin; i < end; ++i)
+              ++count[digit(keys[i])];
+          }
+        });
+    bool single_digit = false;
+    scipp::index offset = 0;
+    for (scipp::index d = 0; d < radix_size; ++d) {
+      const auto digit_begin = offset;
+      for (auto &count : offsets) {
+        const auto n = count[d];
+        count[d] = offset;
+        offset += n;
+      }
+      single_digit |= offset - digit_begin == size;
+    }
+    if (single_digit)
+      continue;
+    parallel::parallel_for(
+        parallel::blocked_range(0, n_chunk, 1), [&](const auto &range) {
+          for (scipp::index chunk = range.begin(); chunk < range.end();
+               ++chunk) {
+            auto &position = offsets[chunk];
+            const auto [begin, end] = chunk_range(chunk);
+            for (scipp::index i = begin; i < end; ++i) {
+              const auto j = position[digit(keys[i])]++;
+              keys_out[j] = keys[i];
+              index_out[j] = index[i];
+            }
+          }
+        });
+    std::swap(keys, keys_out);
+    std::swap(index, index_out);
+  }
+  if (index.data() != result.data())
+    std::copy(index.begin(), index.end(), result.begin());
+}
+
+template <class T>
+std::vector<scipp::index> comparison_argsort(std::span<const T> keys,
+                                             const SortOrder order) {
+  std::vector<scipp::index> perm(keys.size());
+  std::iota(perm.begin(), perm.end(), scipp::index{0});
+  // Ties are broken by position to obtain a stable sort.
+  if (order == SortOrder::Ascending)
+    parallel::parallel_sort(perm.begin(), perm.end(),
+                            [keys](const auto a, const auto b) {
+                              if (keys[a] < keys[b])
+                                return true;
+                              return !(keys[b] < keys[a]) && a < b;
+                            });
+  else
+    parallel::parallel_sort(perm.begin(), perm.end(),
+                            [keys](const auto a, const auto b) {
+                              if (keys[b] < keys[a])
+                                return true;
+                              return !(keys[a] < keys[b]) && a < b;
+                            });
+  return perm;
+}
+
+} // namespace argsort_detail
+
+/// Return the permutation that sorts the elements of `keys` within each of the
+/// given `ranges`, i.e., that sorts by (range index, key).
+///
+/// The result contains, for each range in turn, the positions in `keys` of the
+/// elements of the range in sorted order. Ranges may overlap. The sort is
+/// stable and NaN compares greater than all other values. Only arithmetic and
+/// time-point keys are supported.
+///
+/// Short ranges are sorted using a comparison sort, many ranges in parallel.
+/// Long ranges are sorted one after the other using a parallel radix sort.
+/// Scratch memory is two keys and one position per element of the longest
+/// range that uses the radix sort.
+template <class T>
+std::vector<scipp::index>
+argsort(const std::span<const T> keys,
+        const std::span<const scipp::index_pair> ranges,
+        const SortOrder order = SortOrder::Ascending) {
+  using namespace argsort_detail;
+  static_assert(is_radix_sortable_v<T>);
+  using U = decltype(radix_key(std::declval<T>()));
+  const auto key = [order](const T &x) {
+    return order == SortOrder::Ascending ? radix_key(x)
+                                         : static_cast<U>(~radix_key(x));
+  };
+  const auto nrange = scipp::size(ranges);
+  std::vector<scipp::index> offsets(nrange + 1, 0);
+  scipp::index max_radix_sort_size = 0;
+  for (scipp::index r = 0; r < nrange; ++r) {
+    const auto size = ranges[r].second - ranges[r].first;
+    offsets[r + 1] = offsets[r] + size;
+    if (size >= min_radix_sort_size)
+      max_radix_sort_size = std::max(max_radix_sort_size, size);
+  }
+  std::vector<scipp::index> perm(offsets.back());
+  parallel::parallel_for(
+      parallel::blocked_range(0, nrange), [&](const auto &range) {
+        for (scipp::index r = range.begin(); r < range.end(); ++r) {
+          const auto begin = ranges[r].first;
+          const auto size = ranges[r].second - begin;
+          if (size >= min_radix_sort_size)
+            continue;
+          const auto out = perm.begin() + offsets[r];
+          std::iota(out, out + size, begin);
+          std::stable_sort(out, out + size,
+                           [&](const scipp::index a, const scipp::index b) {
+                             return key(keys[a]) < key(keys[b]);
+                           });
+        }
+      });
+  if (max_radix_sort_size == 0)
+    return perm;
+  std::vector<U> radix_keys(max_radix_sort_size);
+  std::vector<U> keys_out(max_radix_sort_size);
+  std::vector<scipp::index> perm_out(max_radix_sort_size);
+  for (scipp::index r = 0; r < nrange; ++r) {
+    const auto begin = ranges[r].first;
+    const auto size = ranges[r].second - begin;
+    if (size < min_radix_sort_size)
+      continue;
+    const auto out = std::span(perm).subspan(offsets[r], size);
+    parallel::parallel_for(
+        parallel::blocked_range(0, size), [&](const auto &range) {
+          for (scipp::index i = range.begin(); i < range.end(); ++i) {
+            radix_keys[i] = key(keys[begin + i]);
+            out[i] = begin + i;
+          }
+        });
+    radix_sort(std::span(radix_keys).first(size), out,
+               std::span(keys_out).first(size),
+               std::span(perm_out).first(size));
+  }
+  return perm;
+}
+
+/// Return the permutation that sorts `keys`.
+///
+/// The sort is stable. NaN compares greater than all other values. Arithmetic
+/// and time-point keys are sorted using a radix sort, all other keys using a
+/// parallel comparison sort.
+template <class T>
+std::vector<scipp::index>
+argsort(const std::span<const T> keys,
+        const SortOrder order = SortOrder::Ascending) {
+  if constexpr (argsort_detail::is_radix_sortable_v<T>) {
+    const std::array ranges{scipp::index_pair{0, scipp::size(keys)}};
+    return argsort(keys, std::span<const scipp::index_pair>(ranges), order);
+  } else {
+    return argsort_detail::comparison_argsort(keys, order);
+  }
+}
+
+} // namespace scipp::core
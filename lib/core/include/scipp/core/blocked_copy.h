@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include "scipp/common/index.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/sizes.h"
+
+namespace scipp::core {
+
+namespace blocked_copy_detail {
+
+/// Number of elements copied by a leaf of the recursion. Source and
+/// destination of a leaf should fit into the L1 cache together.
+template <class T>
+constexpr scipp::index block_volume =
+    std::max(scipp::index{1}, scipp::index{8 * 1024} /
+                                  static_cast<scipp::index>(sizeof(T)));
+
+struct CopyDim {
+  scipp::index size;
+  scipp::index src_stride;
+  scipp::index dst_stride;
+};
+
+using CopyDims = boost::container::small_vector<CopyDim, NDIM_OP_MAX>;
+using Box =
+    boost::container::small_vector<std::pair<scipp::index, scipp::index>,
+                                   NDIM_OP_MAX>;
+
+/// Return dims ordered by decreasing destination stride, i.e., the last dim
+/// is contiguous in the destination. Dims of length 1 are dropped and dims
+/// that are contiguous in both source and destination are merged.
+inline CopyDims
+make_copy_dims(const std::span<const scipp::index> shape,
+               const std::span<const scipp::index> src_strides,
+               const std::span<const scipp::index> dst_strides) {
+  CopyDims dims;
+  for (size_t d = 0; d < shape.size(); ++d)
+    if (shape[d] != 1)
+      dims.push_back({shape[d], src_strides[d], dst_strides[d]});
+  std::stable_sort(dims.begin(), dims.end(), [](const auto &a, const auto &b) {
+    return a.dst_stride > b.dst_stride;
+  });
+  CopyDims merged;
+  for (auto it = dims.rbegin(); it != dims.rend(); ++it) {
+    if (!merged.empty()) {
+      auto &inner = merged.front();
+      if (it->src_stride == inner.src_stride * inner.size &&
+          it->dst_stride == inner.dst_stride * inner.size) {
+        inner.size *= it->size;
+        continue;
+      }
+    }
+    merged.insert(merged.begin(), *it);
+  }
+  return merged;
+}
+
+template <class T>
+void copy_leaf(const T *src, T *dst, const CopyDim *dims,
+               const Box::value_type *box, const scipp::index ndim) {
+  const auto [begin, end] = box[0];
+  const auto src_stride = dims[0].src_stride;
+  const auto dst_stride = dims[0].dst_stride;
+  if (ndim == 1) {
+    for (scipp::index i = begin; i < end; ++i)
+      dst[i * dst_stride] = src[i * src_stride];
+  } else {
+    for (scipp::index i = begin; i < end; ++i)
+      copy_leaf(src + i * src_stride, dst + i * dst_stride, dims + 1, box + 1,
+                ndim - 1);
+  }
+}
+
+/// Cache-oblivious copy of `box`: The longest dim of the box is split in
+/// halves until the box is small enough, such that every leaf accesses a
+/// compact block of both source and destination.
+template <class T>
+void copy_box(const T *src, T *dst, const CopyDims &dims, Box &box) {
+  scipp::index volume = 1;
+  scipp::index split = 0;
+  for (size_t d = 0; d < box.size(); ++d) {
+    const auto extent = box[d].second - box[d].first;
+    volume *= extent;
+    if (extent > box[split].second - box[split].first)
+      split = d;
+  }
+  if (volume <= block_volume<T>) {
+    if (volume > 0)
+      copy_leaf(src, dst, dims.data(), box.data(), scipp::size(dims));
+    return;
+  }
+  const auto [begin, end] = box[split];
+  const auto mid = begin + (end - begin) / 2;
+  box[split].second = mid;
+  copy_box(src, dst, dims, box);
+  box[split] = {mid, end};
+  copy_box(src, dst, dims, box);
+  box[split].first = begin;
+}
+
+} // namespace blocked_copy_detail
+
+/// Return true if copying between the given layouts requires a transposition,
+/// i.e., if the contiguous dim of the destination is not the contiguous dim
+/// of the source. `blocked_copy` is faster than copying in destination order
+/// in that case.
+inline bool
+is_transposing_copy(const std::span<const scipp::index> shape,
+                    const std::span<const scipp::index> src_strides,
+                    const std::span<const scipp::index> dst_strides) {
+  const auto dims =
+      blocked_copy_detail::make_copy_dims(shape, src_strides, dst_strides);
+  if (dims.size() < 2)
+    return false;
+  const auto src_inner = std::min_element(
+      dims.begin(), dims.end(),
+      [](const auto &a, const auto &b) { return a.src_stride < b.src_stride; });
+  return src_inner != dims.end() - 1;
+}
+
+/// Copy the strided array `src` to the strided array `dst` of equal shape.
+///
+/// Strides are given in the storage order of `shape`, source and destination
+/// must not overlap. Elements are copied in blocks that are compact in both
+/// source and destination, avoiding the cache misses of a naive transposing
+/// copy. The outermost destination dim is split between threads.
+template <class T>
+void blocked_copy(const T *src, T *dst,
+                  const std::span<const scipp::index> shape,
+                  const std::span<const scipp::index> src_strides,
+                  const std::span<const scipp::index> dst_strides) {
+  using namespace blocked_copy_detail;
+  const auto dims = make_copy_dims(shape, src_strides, dst_strides);
+  if (dims.empty()) { // all dims have length 1
+    *dst = *src;
+    return;
+  }
+  Box box;
+  for (const auto &dim : dims)
+    box.emplace_back(0, dim.size);
+  parallel::parallel_for(
+      parallel::blocked_range(0, dims.front().size), [&](const auto &range) {
+        auto sub_box = box;
+        sub_box.front() = {range.begin(), range.end()};
+        copy_box(src, dst, dims, sub_box);
+      });
+}
+
+} // namespace scipp::core
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <cstddef>
+
+#include "scipp-core_export.h"
+
+/// CPU cache parameters used for tuning kernels.
+namespace scipp::core::cache {
+
+/// Size of a cache line in bytes. This is 64 on all common x86 and ARM
+/// processors.
+constexpr std::size_t line_size = 64;
+
+/// Size of the L2 cache of a single core in bytes.
+///
+/// Determined once from the operating system. If it cannot be determined, a
+/// conservative default of 512 KiB is returned.
+SCIPP_CORE_EXPORT std::size_t l2_size() noexcept;
+/// Override the L2 size used for tuning, e.g., for testing. 0 restores the
+/// value determined from the operating system.
+SCIPP_CORE_EXPORT void set_l2_size(std::size_t bytes) noexcept;
+
+} // namespace scipp::core::cache
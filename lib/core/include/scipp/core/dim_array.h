@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "scipp/common/index.h"
+
+namespace scipp::core {
+
+/// Per-dimension state of an iteration, such as shape, strides, or the current
+/// multi-dimensional index.
+///
+/// Behaves like a vector, but the first `Stack` elements are stored in a
+/// std::array and only elements beyond that are stored on the heap. Iteration
+/// with up to `Stack` dimensions does thus not allocate, and element access
+/// with an index known at compile time, such as the inner dimension, is a
+/// plain std::array access.
+template <class T, scipp::index Stack> class DimArray {
+  template <class Array> class Iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = decltype(std::declval<Array &>()[0]);
+
+    Iterator(Array &array, const scipp::index i) noexcept
+        : m_array(&array), m_index(i) {}
+
+    reference operator*() const noexcept { return (*m_array)[m_index]; }
+    Iterator &operator++() noexcept {
+      ++m_index;
+      return *this;
+    }
+    Iterator operator++(int) noexcept { return {*m_array, m_index++}; }
+    Iterator &operator--() noexcept {
+      --m_index;
+      return *this;
+    }
+    Iterator operator--(int) noexcept { return {*m_array, m_index--}; }
+    Iterator operator+(const scipp::index n) const noexcept {
+      return {*m_array, m_index + n};
+    }
+    bool operator==(const Iterator &other) const noexcept {
+      return m_index == other.m_index;
+    }
+    bool operator!=(const Iterator &other) const noexcept {
+      return m_index != other.m_index;
+    }
+
+  private:
+    Array *m_array;
+    scipp::index m_index;
+  };
+
+public:
+  [[nodiscard]] T &operator[](const scipp::index i) noexcept {
+    return i < Stack ? m_stack[i] : m_heap[i - Stack].value;
+  }
+  [[nodiscard]] const T &operator[](const scipp::index i) const noexcept {
+    return i < Stack ? m_stack[i] : m_heap[i - Stack].value;
+  }
+
+  [[nodiscard]] scipp::index size() const noexcept { return m_size; }
+
+  /// Resize to `size` elements, new elements are value-initialized.
+  void resize(const scipp::index size) {
+    for (auto i = m_size; i < std::min(size, Stack); ++i)
+      m_stack[i] = T{};
+    m_heap.resize(std::max(size - Stack, scipp::index{0}));
+    m_size = size;
+  }
+
+  void push_back(const T &value) { emplace_back() = value; }
+  T &emplace_back() {
+    resize(m_size + 1);
+    return back();
+  }
+
+  [[nodiscard]] T &back() noexcept { return (*this)[m_size - 1]; }
+
+  [[nodiscard]] auto begin() noexcept { return Iterator<DimArray>(*this, 0); }
+  [[nodiscard]] auto end() noexcept {
+    return Iterator<DimArray>(*this, m_size);
+  }
+  [[nodiscard]] auto begin() const noexcept {
+    return Iterator<const DimArray>(*this, 0);
+  }
+  [[nodiscard]] auto end() const noexcept {
+    return Iterator<const DimArray>(*this, m_size);
+  }
+
+  bool operator==(const DimArray &other) const noexcept {
+    const auto stack_size = std::min(m_size, Stack);
+    return m_size == other.m_size &&
+           std::equal(m_stack.begin(), m_stack.begin() + stack_size,
+                      other.m_stack.begin()) &&
+           m_heap == other.m_heap;
+  }
+
+private:
+  /// Wrapping heap elements in a struct tells the compiler that accesses to
+  /// the heap cannot alias the std::array of this or any other DimArray, so
+  /// the latter can be kept in registers by the owner.
+  struct HeapElement {
+    T value{};
+    bool operator==(const HeapElement &) const = default;
+  };
+
+  std::array<T, Stack> m_stack{};
+  std::vector<HeapElement> m_heap;
+  scipp::index m_size{0};
+};
+
+} // namespace scipp::core
@@ -6,12 +6,15 @@
 
 #include <algorithm>
 #include <numeric>
+#include <span>
+#include <vector>
 
 #include "scipp/common/numeric.h"
 #include "scipp/common/overloaded.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
 #include "scipp/core/histogram.h"
+#include "scipp/core/partial_reduce.h"
 #include "scipp/core/transform_common.h"
 
 namespace scipp::core::element {
@@ -33,61 +36,146 @@ namespace histogram_detail {
 template <class Coord, class Weight>
 using args = std::tuple<std::span<Weight>, std::span<const Coord>,
                         std::span<const Weight>, std::span<const Coord>>;
+
+/// Fill events in [begin, end) into histogram with linear bins.
+template <class Data, class Events, class Weights, class Edges>
+void fill_linspace(const Data &data, const Events &events,
+                   const Weights &weights, const Edges &edges,
+                   const scipp::index begin, const scipp::index end) {
+  const auto params = core::linear_edge_params(edges);
+  for (scipp::index i = begin; i < end; ++i)
+    if (const auto bin = get_bin<scipp::index>(events[i], edges, params);
+        bin >= 0)
+      iadd(data, bin, weights, i);
+}
+
+/// Fill events in [begin, end) into histogram with sorted, non-linear bins.
+template <class Data, class Events, class Weights, class Edges>
+void fill_sorted(const Data &data, const Events &events, const Weights &weights,
+                 const Edges &edges, const scipp::index begin,
+                 const scipp::index end) {
+  for (scipp::index i = begin; i < end; ++i) {
+    const auto x = events[i];
+    auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    if (it != edges.end() && it != edges.begin())
+      iadd(data, --it - edges.begin(), weights, i);
+  }
+}
+
+template <class Data, class Events, class Weights, class Edges>
+void fill(const Data &data, const Events &events, const Weights &weights,
+          const Edges &edges, const bool linspace, const scipp::index begin,
+          const scipp::index end) {
+  if (linspace)
+    fill_linspace(data, events, weights, edges, begin, end);
+  else
+    fill_sorted(data, events, weights, edges, begin, end);
 }
 
+template <class Data> auto values_of(const Data &data) {
+  if constexpr (is_ValueAndVariance_v<Data>)
+    return data.value;
+  else
+    return data;
+}
+
+/// Fill a single histogram using multiple threads if there are many events.
+///
+/// Events are split into chunks, each filling a private partial histogram, see
+/// core::partial_reduce.
+template <class Data, class Events, class Weights, class Edges>
+void fill_parallel(const Data &data, const Events &events,
+                   const Weights &weights, const Edges &edges,
+                   const bool linspace) {
+  const auto size = scipp::size(events);
+  const auto nbin = scipp::size(edges) - 1;
+  if (nbin <= 0)
+    return;
+  const auto n_chunk = partial_reduce::chunk_count(size, nbin);
+  if (n_chunk <= 1)
+    return fill(data, events, weights, edges, linspace, 0, size);
+
+  using T = std::remove_cvref_t<decltype(values_of(data)[0])>;
+  constexpr bool variances = is_ValueAndVariance_v<Data>;
+  const partial_reduce::Partials<T> values(n_chunk, nbin);
+  const partial_reduce::Partials<T> vars(variances ? n_chunk : 0, nbin);
+  const auto partial = [&](const scipp::index chunk) {
+    if constexpr (variances)
+      return ValueAndVariance{values[chunk], vars[chunk]};
+    else
+      return values[chunk];
+  };
+  partial_reduce::run(
+      n_chunk, size, nbin,
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        fill(partial(chunk), events, weights, edges, linspace, begin, end);
+      },
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        const auto part = partial(chunk);
+        for (auto bin = begin; bin != end; ++bin)
+          iadd(data, bin, part, bin);
+      });
+}
+
+/// Add events to histogram, without zeroing it first.
+constexpr auto add = [](const auto &data, const auto &events,
+                        const auto &weights, const auto &edges) {
+  // Special implementation for linear bins. Gives a 1x to 20x speedup
+  // for few and many events per histogram, respectively.
+  const bool linspace = scipp::numeric::islinspace(edges);
+  if (!linspace)
+    core::expect::histogram::sorted_edges(edges);
+  fill_parallel(data, events, weights, edges, linspace);
+};
+
+using types = element::arg_list_t<
+    args<double, double>, args<double, float>, args<double, int64_t>,
+    args<double, int32_t>, args<float, double>, args<float, float>,
+    args<float, int64_t>, args<float, int32_t>, args<int32_t, double>,
+    args<int32_t, float>, args<int32_t, int64_t>, args<int32_t, int32_t>,
+    args<int64_t, double>, args<int64_t, float>, args<int64_t, int64_t>,
+    args<int64_t, int32_t>, args<time_point, double>,
+    args<time_point, float>, args<time_point, int64_t>,
+    args<time_point, int32_t>>;
+
+constexpr auto expect_edge_unit = [](const sc_units::Unit &events_unit,
+                                     const sc_units::Unit &edge_unit) {
+  if (events_unit != edge_unit)
+    throw except::UnitError(
+        "Bin edges must have same unit as the input coordinate.");
+};
+} // namespace histogram_detail
+
 static constexpr auto histogram = overloaded{
-    element::arg_list<histogram_detail::args<double, double>,
-                      histogram_detail::args<double, float>,
-                      histogram_detail::args<double, int64_t>,
-                      histogram_detail::args<double, int32_t>,
-                      histogram_detail::args<float, double>,
-                      histogram_detail::args<float, float>,
-                      histogram_detail::args<float, int64_t>,
-                      histogram_detail::args<float, int32_t>,
-                      histogram_detail::args<int32_t, double>,
-                      histogram_detail::args<int32_t, float>,
-                      histogram_detail::args<int32_t, int64_t>,
-                      histogram_detail::args<int32_t, int32_t>,
-                      histogram_detail::args<int64_t, double>,
-                      histogram_detail::args<int64_t, float>,
-                      histogram_detail::args<int64_t, int64_t>,
-                      histogram_detail::args<int64_t, int32_t>,
-                      histogram_detail::args<time_point, double>,
-                      histogram_detail::args<time_point, float>,
-                      histogram_detail::args<time_point, int64_t>,
-                      histogram_detail::args<time_point, int32_t>>,
+    histogram_detail::types{},
     [](const auto &data, const auto &events, const auto &weights,
        const auto &edges) {
       zero(data);
-      // Special implementation for linear bins. Gives a 1x to 20x speedup
-      // for few and many events per histogram, respectively.
-      if (scipp::numeric::islinspace(edges)) {
-        const auto params = core::linear_edge_params(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          if (const auto bin = get_bin<scipp::index>(x, edges, params);
-              bin >= 0)
-            iadd(data, bin, weights, i);
-        }
-      } else {
-        core::expect::histogram::sorted_edges(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          auto it = std::upper_bound(edges.begin(), edges.end(), x);
-          if (it != edges.end() && it != edges.begin())
-            iadd(data, --it - edges.begin(), weights, i);
-        }
-      }
+      histogram_detail::add(data, events, weights, edges);
     },
     [](const sc_units::Unit &events_unit, const sc_units::Unit &weights_unit,
        const sc_units::Unit &edge_unit) {
-      if (events_unit != edge_unit)
-        throw except::UnitError(
-            "Bin edges must have same unit as the input coordinate.");
+      histogram_detail::expect_edge_unit(events_unit, edge_unit);
       return weights_unit;
     },
     transform_flags::expect_in_variance_if_out_variance,
     transform_flags::expect_no_variance_arg<1>,
     transform_flags::expect_no_variance_arg<3>};
 
+/// Add events to an existing histogram in-place.
+static constexpr auto histogram_add = overloaded{
+    histogram_detail::types{}, histogram_detail::add,
+    [](const sc_units::Unit &hist_unit, const sc_units::Unit &events_unit,
+       const sc_units::Unit &weights_unit, const sc_units::Unit &edge_unit) {
+      histogram_detail::expect_edge_unit(events_unit, edge_unit);
+      if (hist_unit != weights_unit)
+        throw except::UnitError(
+            "Weights must have same unit as the accumulated histogram.");
+    },
+    transform_flags::expect_in_variance_if_out_variance,
+    transform_flags::expect_no_variance_arg<1>,
+    transform_flags::expect_no_variance_arg<3>};
+
 } // namespace scipp::core::element
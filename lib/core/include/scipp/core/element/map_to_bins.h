@@ -3,13 +3,18 @@
 /// @file
 /// @author Simon Heybrock
 #pragma once
+#include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include "scipp/common/overloaded.h"
+#include "scipp/core/cache.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
 #include "scipp/core/histogram.h"
+#include "scipp/core/scratch_buffer.h"
 #include "scipp/core/subbin_sizes.h"
 #include "scipp/core/time_point.h"
 #include "scipp/core/transform_common.h"
@@ -47,11 +52,18 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
 
   using Val =
       std::conditional_t<is_ValueAndVariance_v<T>, typename T::value_type, T>;
-  // TODO Ideally this buffer would be reused (on a per-thread basis)
-  // for every application of the kernel.
-  std::vector<std::tuple<std::vector<typename Val::value_type>,
-                         std::vector<InnerIndex>>>
-      chunks((bins.size() - 1) / chunksize + 1);
+  // Buffers are reused by all applications of the kernel on this thread.
+  scratch::Lease<std::vector<std::tuple<std::vector<typename Val::value_type>,
+                                        std::vector<InnerIndex>>>>
+      lease;
+  auto &chunks = *lease;
+  const scipp::index n_chunk = (scipp::size(bins) - 1) / chunksize + 1;
+  if (scipp::size(chunks) < n_chunk)
+    chunks.resize(n_chunk);
+  for (scipp::index i_chunk = 0; i_chunk < n_chunk; ++i_chunk) {
+    std::get<0>(chunks[i_chunk]).clear();
+    std::get<1>(chunks[i_chunk]).clear();
+  }
   for (scipp::index i = 0; i < size;) {
     // We operate in blocks so the size of the map of buffers, i.e.,
     // additional memory use of the algorithm, is bounded. This also
@@ -74,7 +86,7 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
       ind.emplace_back(j);
     }
     // 2. Map chunks to bins
-    for (scipp::index i_chunk = 0; i_chunk < scipp::size(chunks); ++i_chunk) {
+    for (scipp::index i_chunk = 0; i_chunk < n_chunk; ++i_chunk) {
       auto &[vals, ind] = chunks[i_chunk];
       for (scipp::index j = 0; j < scipp::size(ind); ++j) {
         const auto i_bin = chunksize * i_chunk + ind[j];
@@ -91,6 +103,79 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
   }
 };
 
+template <class T>
+constexpr bool can_write_combine_v =
+    std::is_trivially_copyable_v<T> && cache::line_size % sizeof(T) == 0;
+
+/// Map to bins using software write-combining.
+///
+/// Every output bin gets a staging buffer of one cache line in a contiguous
+/// (and typically L2-resident) scratch array. Events are appended to the
+/// staging buffer of their bin, which is copied to the output whenever it is
+/// full. Writes to the output are thus full cache lines instead of single
+/// elements scattered over as many active cache lines as there are bins. This
+/// is efficient as long as the staging buffers of all bins fit into L2.
+auto map_to_bins_write_combining = [](auto &binned, auto &bins,
+                                      const auto &data,
+                                      const auto &bin_indices) {
+  using T = std::decay_t<decltype(data)>;
+  using Val =
+      std::conditional_t<is_ValueAndVariance_v<T>, typename T::value_type, T>;
+  using E = typename Val::value_type;
+  constexpr scipp::index line = cache::line_size / sizeof(E);
+  constexpr scipp::index stride = is_ValueAndVariance_v<T> ? 2 * line : line;
+  static_assert(line <= std::numeric_limits<uint8_t>::max());
+  const auto size = scipp::size(bin_indices);
+  const auto n_bin = scipp::size(bins);
+
+  scratch::Lease<std::tuple<std::vector<E>, std::vector<uint8_t>>> lease;
+  auto &[staging, fill] = *lease;
+  // Over-allocate by one line so staging buffers can be aligned to lines.
+  staging.resize(n_bin * stride + line);
+  fill.assign(n_bin, 0);
+  E *base = staging.data();
+  if (const auto misalign =
+          reinterpret_cast<std::uintptr_t>(base) % cache::line_size;
+      misalign != 0 && misalign % sizeof(E) == 0)
+    base += (cache::line_size - misalign) / sizeof(E);
+
+  // Plain loops instead of std::copy_n, which would call memmove for every
+  // line. Inlined with `n == line` the loops compile to a few vector stores.
+  const auto flush = [&](const scipp::index i_bin, const scipp::index n) {
+    const E *src = base + i_bin * stride;
+    const auto offset = bins[i_bin];
+    for (scipp::index k = 0; k < n; ++k) {
+      if constexpr (is_ValueAndVariance_v<T>) {
+        binned.value[offset + k] = src[k];
+        binned.variance[offset + k] = src[line + k];
+      } else {
+        binned[offset + k] = src[k];
+      }
+    }
+    bins[i_bin] += n;
+  };
+  for (scipp::index i = 0; i < size; ++i) {
+    const auto i_bin = bin_indices[i];
+    if (i_bin < 0)
+      continue;
+    E *dst = base + i_bin * stride;
+    auto &n = fill[i_bin];
+    if constexpr (is_ValueAndVariance_v<T>) {
+      dst[n] = data.value[i];
+      dst[line + n] = data.variance[i];
+    } else {
+      dst[n] = data[i];
+    }
+    if (++n == line) {
+      flush(i_bin, line);
+      n = 0;
+    }
+  }
+  for (scipp::index i_bin = 0; i_bin < n_bin; ++i_bin)
+    if (fill[i_bin] != 0)
+      flush(i_bin, fill[i_bin]);
+};
+
 // - Each span covers an *input* bin.
 // - `offsets` Start indices of the output bins
 // - `bin_indices` Target output bin index (within input bin)
@@ -112,7 +197,9 @@ static constexpr auto bin = overloaded{
        const sc_units::Unit &data, const sc_units::Unit &) { binned = data; },
     [](const auto &binned, const auto &offsets, const auto &data,
        const auto &bin_indices) {
-      auto bins(offsets.sizes());
+      scratch::Lease<std::vector<scipp::index>> lease;
+      auto &bins = *lease;
+      bins.assign(offsets.sizes().begin(), offsets.sizes().end());
       // If there are many bins, we have two performance issues:
       // 1. `bins` is large and will not fit into L1, L2, or L3 cache.
       // 2. Writes to output are very random, implying a cache miss for every
@@ -120,9 +207,20 @@ static constexpr auto bin = overloaded{
       // We can avoid some of this issue by first sorting into chunks, then
       // chunks into bins. For example, instead of mapping directly to 65536
       // bins, we may map to 256 chunks, and each chunk to 256 bins.
+      // If the staging buffers for write-combining fit into L2 this is faster
+      // than chunking, since events are copied only once.
       const bool many_bins = bins.size() > 512;
       const bool multiple_events_per_bin = bins.size() * 4 < bin_indices.size();
+      using Data = std::decay_t<decltype(data)>;
+      using Val = std::conditional_t<is_ValueAndVariance_v<Data>,
+                                     typename Data::value_type, Data>;
+      constexpr auto staging_bytes_per_bin =
+          is_ValueAndVariance_v<Data> ? 2 * cache::line_size : cache::line_size;
       if (many_bins && multiple_events_per_bin) { // avoid overhead
+        if constexpr (can_write_combine_v<typename Val::value_type>)
+          if (bins.size() * staging_bytes_per_bin <= cache::l2_size())
+            return map_to_bins_write_combining(binned, bins, data,
+                                               bin_indices);
         if (bins.size() <= 128 * 128)
           map_to_bins_chunkwise<128>(binned, bins, data, bin_indices);
         else if (bins.size() <= 256 * 256)
@@ -25,8 +25,12 @@ template <class Compare> constexpr auto make_sort(Compare compare) {
         using T = std::decay_t<decltype(range)>;
         constexpr bool vars = is_ValueAndVariance_v<T>;
         if constexpr (vars) {
-          std::vector<ValueAndVariance<typename T::value_type::value_type>>
+          // Reused across calls to avoid an allocation for every sorted range,
+          // e.g., when sorting many small bins.
+          thread_local std::vector<
+              ValueAndVariance<typename T::value_type::value_type>>
               zipped;
+          zipped.clear();
           for (scipp::index i = 0; i < scipp::size(range.value); i++) {
             zipped.emplace_back(range.value[i], range.variance[i]);
           }
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <span>
+#include <string>
+
+#include "scipp/common/overloaded.h"
+#include "scipp/core/eigen.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/time_point.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+namespace take_detail {
+template <class T>
+using args = std::tuple<std::span<T>, std::span<const T>,
+                        std::span<const int64_t>>;
+
+/// Minimum number of elements per chunk when gathering a single range.
+constexpr scipp::index min_elements_per_chunk = 16384;
+
+template <class Out, class In>
+void gather(const Out &out, const In &in,
+            const std::span<const int64_t> &indices) {
+  parallel::parallel_for(
+      parallel::blocked_range(0, scipp::size(indices), min_elements_per_chunk),
+      [&](const auto &range) {
+        for (scipp::index i = range.begin(); i < range.end(); ++i)
+          out[i] = in[indices[i]];
+      });
+}
+} // namespace take_detail
+
+/// Gather elements, `out[i] = in[indices[i]]`.
+///
+/// Indices are not checked, this is the responsibility of the caller.
+constexpr auto take = overloaded{
+    arg_list<take_detail::args<double>, take_detail::args<float>,
+             take_detail::args<int64_t>, take_detail::args<int32_t>,
+             take_detail::args<bool>, take_detail::args<time_point>,
+             take_detail::args<std::string>,
+             take_detail::args<Eigen::Vector3d>>,
+    transform_flags::expect_in_variance_if_out_variance,
+    transform_flags::expect_no_variance_arg<2>,
+    [](sc_units::Unit &out, const sc_units::Unit &in, const sc_units::Unit &) {
+      out = in;
+    },
+    [](const auto &out, const auto &in, const auto &indices) {
+      if constexpr (is_ValueAndVariance_v<std::decay_t<decltype(out)>>) {
+        take_detail::gather(out.value, in.value, indices);
+        take_detail::gather(out.variance, in.variance, indices);
+      } else {
+        take_detail::gather(out, in, indices);
+      }
+    }};
+
+} // namespace scipp::core::element
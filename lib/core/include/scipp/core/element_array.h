@@ -6,26 +6,72 @@
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "scipp/common/index.h"
+#include "scipp/core/memory_pool.h"
+#include "scipp/core/numa.h"
 #include "scipp/core/parallel.h"
 
 namespace scipp::core {
 
+namespace detail {
+/// Deleter for element_array buffers, which may come from the memory pool.
+template <class T> struct element_array_deleter {
+  scipp::index size{0};
+  bool pooled{false};
+  /// Keeps an external buffer alive. Set if the array does not own its buffer.
+  std::shared_ptr<const void> owner{};
+  void operator()(T *ptr) const noexcept {
+    if (owner) {
+      return;
+    } else if (pooled) {
+      std::destroy_n(ptr, size);
+      memory_pool::deallocate(ptr, sizeof(T) * size);
+    } else {
+      delete[] ptr;
+    }
+  }
+};
+template <class T>
+using element_array_ptr = std::unique_ptr<T[], element_array_deleter<T>>;
+} // namespace detail
+
 /// Replacement for C++20 std::make_unique_for_overwrite
+///
+/// Uses memory_pool if enabled. Buffers of trivial element types are placed
+/// according to the current numa::Policy.
 template <class T>
 auto make_unique_for_overwrite_array(const scipp::index size) {
   // This is specifically written in this way to avoid an internal cppcheck
   // error which happens when we try to handle both arrays and 'normal' pointers
   // using std::remove_extent_t<T> as the type we pass to the unique_ptr.
-  using Ptr = std::unique_ptr<T[]>;
+  using Ptr = detail::element_array_ptr<T>;
   // We add a size and sign check to avoid warnings about exceeding maximum
   // object size. See e.g.
   // https://gcc.gnu.org/bugzilla//show_bug.cgi?id=85783#c3
-  if ((size <= PTRDIFF_MAX) && (size >= 0))
-    return Ptr(new T[size]);
-  throw std::runtime_error(
-      "Allocation size is either negative or exceeds PTRDIFF_MAX");
+  if ((size > PTRDIFF_MAX / scipp::index(sizeof(T))) || (size < 0))
+    throw std::runtime_error(
+        "Allocation size is either negative or exceeds PTRDIFF_MAX");
+  constexpr bool placeable = std::is_trivially_default_constructible_v<T>;
+  if (!memory_pool::is_enabled()) {
+    auto *ptr = new T[size];
+    if constexpr (placeable)
+      numa::place(ptr, size, sizeof(T));
+    return Ptr(ptr, {size, false});
+  }
+  const auto bytes = sizeof(T) * size;
+  auto *ptr = static_cast<T *>(memory_pool::allocate(bytes));
+  if constexpr (placeable)
+    numa::place(ptr, size, sizeof(T));
+  try {
+    std::uninitialized_default_construct_n(ptr, size);
+  } catch (...) {
+    memory_pool::deallocate(ptr, bytes);
+    throw;
+  }
+  return Ptr(ptr, {size, true});
 }
 
 /// Tag for requesting default-initialization in methods of class element_array.
@@ -41,9 +87,12 @@ static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 /// - Support default-initialized arrays as an internal optimization in
 ///   implementing transform. This avoids costly initialization in cases where
 ///   data would be immediately overwritten afterwards.
+/// - Buffers can be recycled via memory_pool, which std::vector's allocator
+///   model makes awkward for element types with non-trivial constructors.
 /// - As a minor benefit, since the implementation has to store a pointer and a
 ///   size, we can at the same time support an "optional" behavior, as used for
 ///   the array of variances in a variable.
+/// - Arrays can reference external buffers, e.g., from NumPy, without copying.
 template <class T> class element_array {
 public:
   using value_type = T;
@@ -88,6 +137,14 @@ public:
   element_array(std::initializer_list<T> init)
       : element_array(init.begin(), init.end()) {}
 
+  /// Construct an array referencing an external buffer of `size` elements.
+  ///
+  /// The array does not own the buffer, `owner` must keep it alive for as long
+  /// as it is referenced. The buffer must be writable.
+  element_array(T *data, const scipp::index size,
+                std::shared_ptr<const void> owner)
+      : m_size(size), m_data(data, {size, false, std::move(owner)}) {}
+
   element_array(element_array &&other) noexcept
       : m_size(other.m_size), m_data(std::move(other.m_data)) {
     other.m_size = -1;
@@ -119,8 +176,13 @@ public:
   }
   T *end() noexcept { return m_size < 0 ? begin() : data() + size(); }
 
+  /// Return true if the array references an external buffer.
+  [[nodiscard]] bool is_external() const noexcept {
+    return static_cast<bool>(m_data.get_deleter().owner);
+  }
+
   void reset() noexcept {
-    m_data.reset();
+    m_data = detail::element_array_ptr<T>();
     m_size = -1;
   }
 
@@ -133,7 +195,7 @@ public:
   /// Resize with default-initialized elements. Use with care.
   void resize(const scipp::index new_size, const init_for_overwrite_t &) {
     if (new_size == 0) {
-      m_data.reset();
+      m_data = detail::element_array_ptr<T>();
       m_size = 0;
     } else if (new_size != size()) {
       m_data = make_unique_for_overwrite_array<T>(new_size);
@@ -152,7 +214,7 @@ private:
     }
   }
   scipp::index m_size{-1};
-  std::unique_ptr<T[]> m_data;
+  detail::element_array_ptr<T> m_data;
 };
 
 } // namespace scipp::core
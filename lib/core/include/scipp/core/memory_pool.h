@@ -4,95 +4,81 @@
 /// @author Simon Heybrock
 #pragma once
 
-#include <array>
-#include <map>
-#include <mutex>
-#include <vector>
+#include <cstddef>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
 
-namespace scipp::core {
-#ifdef _WIN32
-// https://stackoverflow.com/questions/33696092/whats-the-correct-replacement-for-posix-memalign-in-windows
-static int check_align(size_t align) {
-  for (size_t i = sizeof(void *); i != 0; i *= 2)
-    if (align == i)
-      return 0;
-  return EINVAL;
-}
+/// Thread-local size-class cache for array buffers.
+///
+/// Expressions such as `a * b + c` create and drop full-size temporaries. For
+/// large buffers the system allocator typically returns memory to the OS on
+/// free and page-faults it in again on the next allocation. The pool keeps
+/// freed buffers in per-thread free-lists, bucketed into size classes (four
+/// classes per power of two, i.e., at most 25% overhead), so subsequent
+/// allocations of similar size can be served without touching the system
+/// allocator. The per-thread limit grows with the largest buffers allocated,
+/// such that the temporaries of expressions on large arrays are cached too.
+///
+/// The pool is disabled by default. Buffers allocated while the pool is enabled
+/// may safely be deallocated after it has been disabled, and vice versa.
+namespace scipp::core::memory_pool {
 
-static int posix_memalign(void **ptr, size_t align, size_t size) {
-  if (check_align(align))
-    return EINVAL;
+/// Alignment of all buffers returned by `allocate`.
+constexpr std::size_t alignment = 64;
 
-  int saved_errno = errno;
-  void *p = _aligned_malloc(size, align);
-  if (p == NULL) {
-    errno = saved_errno;
-    return ENOMEM;
-  }
+struct Statistics {
+  /// Number of allocations served from a cache.
+  scipp::index hits{0};
+  /// Number of allocations that fell through to the system allocator.
+  scipp::index misses{0};
+  /// Number of bytes currently held in caches of all threads.
+  scipp::index bytes_cached{0};
+  /// Maximum of `bytes_cached` since the last call to `reset_statistics`.
+  scipp::index high_water_mark{0};
+};
 
-  *ptr = p;
-  return 0;
-}
-#endif
+/// Return true if element_array should allocate via the pool.
+SCIPP_CORE_EXPORT bool is_enabled() noexcept;
+/// Enable or disable the pool. Disabling also trims all caches.
+SCIPP_CORE_EXPORT void set_enabled(bool enabled);
 
-class MemoryPool {
-public:
-  void *allocate(size_t size) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    auto &pools = m_pools[size];
-    if (pools[1].empty()) {
-      void *ptr = nullptr;
-      // Always 64 bit aligned
-      int rc = posix_memalign(&ptr, 64, size);
-      if (rc != 0)
-        throw std::runtime_error("Failed to allocate.");
-      pools[0].emplace_back(ptr);
-      return ptr;
-    } else {
-      pools[0].emplace_back(pools[1].back());
-      pools[1].pop_back();
-      return pools[0].back();
-    }
-  }
-  void deallocate(void *ptr) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    for (auto &pools : m_pools) {
-      auto &used = pools.second[0];
-      for (scipp::index i = used.size() - 1; i >= 0; --i) {
-        if (used[i] == ptr) {
-          auto &unused = pools.second[1];
-          used.erase(used.begin() + i);
-          unused.emplace_back(ptr);
-          return;
-        }
-      }
-    }
-    throw std::runtime_error(
-        "Request to deallocate memory that is not owned by us.");
-  }
-  ~MemoryPool() {
-    for (auto &pools : m_pools) {
-      for (auto &pool : pools.second)
-        for (auto &ptr : pool)
-#ifdef _WIN32
-          _aligned_free(ptr);
-#else
-          free(ptr);
-#endif
-    }
-  }
+/// Minimum number of bytes a single thread may cache.
+SCIPP_CORE_EXPORT std::size_t thread_cache_limit() noexcept;
+/// Set the minimum number of bytes a single thread may cache. Existing caches
+/// are trimmed lazily.
+SCIPP_CORE_EXPORT void set_thread_cache_limit(std::size_t bytes) noexcept;
 
-private:
-  mutable std::mutex m_mutex;
-  // Different pool for each size.
-  mutable std::map<size_t, std::array<std::vector<void *>, 2>> m_pools;
-};
+/// Number of buffers of the largest size class seen that a thread may cache.
+SCIPP_CORE_EXPORT std::size_t largest_class_buffers() noexcept;
+/// Let each thread cache at least `count` buffers of the largest size class
+/// allocated since the last `trim`, even if this exceeds
+/// `thread_cache_limit`. Pass 0 to use a fixed limit.
+SCIPP_CORE_EXPORT void set_largest_class_buffers(std::size_t count) noexcept;
+
+/// Maximum number of bytes cached by a single thread, i.e., the larger of
+/// `thread_cache_limit` and `largest_class_buffers` buffers of the largest
+/// size class seen. Buffers larger than this are never cached.
+SCIPP_CORE_EXPORT std::size_t effective_thread_cache_limit() noexcept;
+
+/// Return the capacity of the size class used for a request of `bytes`.
+SCIPP_CORE_EXPORT std::size_t size_class_bytes(std::size_t bytes) noexcept;
+
+/// Allocate `bytes` bytes aligned to `alignment`. Throws std::bad_alloc.
+///
+/// The returned buffer must be released with `deallocate` using the same
+/// `bytes`.
+[[nodiscard]] SCIPP_CORE_EXPORT void *allocate(std::size_t bytes);
+/// Return a buffer obtained from `allocate` to the calling thread's cache.
+SCIPP_CORE_EXPORT void deallocate(void *ptr, std::size_t bytes) noexcept;
+
+/// Release all cached buffers of all threads to the system allocator and
+/// forget the largest size class seen.
+SCIPP_CORE_EXPORT void trim() noexcept;
 
-inline MemoryPool &instance() {
-  static MemoryPool pool;
-  return pool;
-}
+SCIPP_CORE_EXPORT Statistics statistics() noexcept;
+/// Reset hit and miss counters and set the high-water mark to the current
+/// number of cached bytes.
+SCIPP_CORE_EXPORT void reset_statistics() noexcept;
 
-} // namespace scipp::core
+} // namespace scipp::core::memory_pool
@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "scipp/common/index_composition.h"
+#include "scipp/core/dim_array.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/element_array_view.h"
 
@@ -327,20 +328,32 @@ private:
   }
 
   [[nodiscard]] auto shape_it(const scipp::index dim = 0) noexcept {
-    return std::next(m_shape.begin(), dim);
+    return m_shape.begin() + dim;
   }
 
   [[nodiscard]] auto shape_end() noexcept { return m_shape.begin() + m_ndim; }
 
+  /// Pad with one trailing zero-initialized dimension, used as end marker
+  /// and for scalars.
+  void pad_dims() {
+    m_stride.resize(m_ndim + 1);
+    m_coord.resize(m_ndim + 1);
+    m_shape.resize(m_ndim + 1);
+  }
+
+  template <class T> using dim_array = DimArray<T, NDIM_OP_MAX + 1>;
+
   /// Current flat index into the operands.
   std::array<scipp::index, N> m_data_index = {};
-  // This does *not* 0-init the inner arrays!
   /// Stride for each operand in each dimension.
-  std::array<std::array<scipp::index, N>, NDIM_OP_MAX> m_stride = {};
+  ///
+  /// Storage is a std::array for up to NDIM_OP_MAX dimensions after
+  /// flattening, operations with more dimensions allocate.
+  dim_array<std::array<scipp::index, N>> m_stride;
   /// Current index in iteration dimensions for both bin and inner dims.
-  std::array<scipp::index, NDIM_OP_MAX + 1> m_coord = {};
+  dim_array<scipp::index> m_coord;
   /// Shape of the iteration dimensions for both bin and inner dims.
-  std::array<scipp::index, NDIM_OP_MAX + 1> m_shape = {};
+  dim_array<scipp::index> m_shape;
   /// Total number of dimensions.
   scipp::index m_ndim{0};
   /// Number of dense dimensions, i.e. same as m_ndim when not binned,
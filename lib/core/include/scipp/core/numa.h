@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+#include "scipp/core/parallel.h"
+
+/// Placement of large array buffers on multi-socket (NUMA) machines.
+///
+/// Linux places a page on the memory node of the thread that first writes to
+/// it. Buffers that are default-initialized and then filled by a single thread
+/// therefore end up on a single socket, and threads on other sockets access
+/// them at reduced bandwidth. `place` is called by element_array for fresh
+/// buffers and distributes their pages according to the current policy.
+///
+/// On machines with a single memory node, or on platforms other than Linux,
+/// all policies behave like `Policy::Default`.
+namespace scipp::core::numa {
+
+enum class Policy {
+  /// Leave placement to the operating system.
+  Default,
+  /// Touch pages in parallel with a static partition of the index range.
+  /// Operations using `numa::parallel_for` use the same partition while this
+  /// policy is active, so pages land on the node of the thread processing
+  /// them.
+  FirstTouch,
+  /// Interleave pages round-robin over all memory nodes. This does not depend
+  /// on the partition used by later operations.
+  Interleave
+};
+
+/// Buffers smaller than this are never placed explicitly.
+constexpr std::size_t min_place_bytes = 4 * 1024 * 1024;
+
+/// Number of memory nodes of the machine, 1 if unknown.
+SCIPP_CORE_EXPORT scipp::index node_count() noexcept;
+
+SCIPP_CORE_EXPORT Policy policy() noexcept;
+/// Set the policy used for subsequently allocated buffers.
+SCIPP_CORE_EXPORT void set_policy(Policy policy) noexcept;
+
+/// Return true if buffers are placed with `Policy::FirstTouch`, i.e., if the
+/// policy is set and the machine has more than one memory node.
+SCIPP_CORE_EXPORT bool first_touch_active() noexcept;
+
+/// Call `op` in parallel on sub-ranges of [0, size).
+///
+/// Uses the partition of `place` if first-touch placement is active and the
+/// default (load-balancing) partition otherwise.
+template <class Op> void parallel_for(const scipp::index size, Op &&op) {
+  const auto range = parallel::blocked_range(0, size);
+  if (first_touch_active())
+    parallel::static_parallel_for(range, std::forward<Op>(op));
+  else
+    parallel::parallel_for(range, std::forward<Op>(op));
+}
+
+/// Distribute the pages of an uninitialized buffer of `size` elements of
+/// `element_size` bytes according to the current policy.
+///
+/// Must be called before any element is written. For `Policy::FirstTouch`
+/// the first byte of every page is overwritten.
+SCIPP_CORE_EXPORT void place(void *ptr, scipp::index size,
+                             std::size_t element_size) noexcept;
+
+} // namespace scipp::core::numa
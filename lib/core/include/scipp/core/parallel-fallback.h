@@ -11,6 +11,8 @@
 /// Fallback wrappers without actual threading, in case TBB is not available.
 namespace scipp::core::parallel {
 
+inline scipp::index max_concurrency() { return 1; }
+
 class blocked_range {
 public:
   constexpr blocked_range(const scipp::index begin, const scipp::index end,
@@ -30,8 +32,20 @@ template <class Op> void parallel_for(const blocked_range &range, Op &&op) {
   op(range);
 }
 
+template <class Op>
+void static_parallel_for(const blocked_range &range, Op &&op) {
+  op(range);
+}
+
 template <class... Args> void parallel_sort(Args &&...args) {
   std::sort(std::forward<Args>(args)...);
 }
 
+class ThreadLimit {
+public:
+  explicit ThreadLimit(const scipp::index max_threads) {
+    static_cast<void>(max_threads);
+  }
+};
+
 } // namespace scipp::core::parallel
@@ -5,33 +5,107 @@
 #pragma once
 
 #include <algorithm>
+#include <tbb/global_control.h>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
 
 /// Wrappers for multi-threading using TBB.
 namespace scipp::core::parallel {
 
+namespace detail {
+/// Return the arena of the innermost ThreadLimit of the calling thread, or
+/// nullptr if there is none.
+SCIPP_CORE_EXPORT tbb::task_arena *&thread_limit_arena() noexcept;
+
+/// Call `f` in the arena of the innermost ThreadLimit of the calling thread.
+template <class F> void in_arena(F &&f) {
+  if (auto *arena = thread_limit_arena())
+    arena->execute(std::forward<F>(f));
+  else
+    f();
+}
+} // namespace detail
+
+/// Return the number of threads available to the calling thread.
+///
+/// This takes into account the task arena the caller runs in as well as limits
+/// set via ThreadLimit.
+inline scipp::index max_concurrency() {
+  const auto *arena = detail::thread_limit_arena();
+  const auto concurrency = arena ? arena->max_concurrency()
+                                 : tbb::this_task_arena::max_concurrency();
+  const auto limit = tbb::global_control::active_value(
+      tbb::global_control::max_allowed_parallelism);
+  return std::max(scipp::index(1),
+                  std::min(scipp::index(concurrency),
+                           static_cast<scipp::index>(limit)));
+}
+
+/// Number of tasks per thread created by the default grain size. More than one
+/// task per thread allows for load balancing if tasks have unequal cost.
+constexpr scipp::index tasks_per_thread = 4;
+
 inline auto blocked_range(const scipp::index begin, const scipp::index end,
                           const scipp::index grainsize = -1) {
   // TBB's default grain-size is 1, which is probably quite inefficient in
-  // some cases, in particular given the slow random-access of ViewIndex. A
-  // good default value is not known right now. In practice this should also
-  // depend heavily on whether we are processing small elements like `double`
-  // or something large like `event_list<double>`.
+  // some cases, in particular given the slow random-access of ViewIndex. We
+  // therefore split into a fixed number of tasks per available thread. Callers
+  // that know the cost of their items, e.g., because they process small
+  // elements like `double` rather than bins, should pass a grain size.
   return tbb::blocked_range<scipp::index>(
       begin, end,
-      grainsize == -1 ? std::max(scipp::index(1), (end - begin) / 24)
-                      : grainsize);
+      grainsize == -1
+          ? std::max(scipp::index(1),
+                     (end - begin) / (tasks_per_thread * max_concurrency()))
+          : grainsize);
 }
 
 template <class... Args> void parallel_for(Args &&...args) {
-  tbb::parallel_for(std::forward<Args>(args)...);
+  detail::in_arena([&]() { tbb::parallel_for(std::forward<Args>(args)...); });
+}
+
+/// Like parallel_for, but split `range` evenly over the available threads in a
+/// deterministic manner. Used where the thread that processes a given
+/// sub-range matters, e.g., for first-touch placement of memory pages.
+template <class Op>
+void static_parallel_for(const tbb::blocked_range<scipp::index> &range,
+                         Op &&op) {
+  detail::in_arena([&]() {
+    tbb::parallel_for(range, std::forward<Op>(op), tbb::static_partitioner{});
+  });
 }
 
 template <class... Args> void parallel_sort(Args &&...args) {
-  tbb::parallel_sort(std::forward<Args>(args)...);
+  detail::in_arena([&]() { tbb::parallel_sort(std::forward<Args>(args)...); });
 }
 
+/// Limit the number of threads used by scipp on the calling thread while an
+/// instance is alive.
+///
+/// Parallel operations started by the calling thread run in a task arena with
+/// the given concurrency. Other threads are not affected, so, e.g., multiple
+/// threads calling scipp can each be limited to their share of the cores. If
+/// limits are nested the smallest applies. Instances must be destroyed on the
+/// thread that created them, in reverse order of creation.
+class ThreadLimit {
+public:
+  explicit ThreadLimit(const scipp::index max_threads)
+      : m_arena(static_cast<int>(
+            std::clamp(max_threads, scipp::index(1), max_concurrency()))),
+        m_previous(detail::thread_limit_arena()) {
+    detail::thread_limit_arena() = &m_arena;
+  }
+  ThreadLimit(const ThreadLimit &) = delete;
+  ThreadLimit &operator=(const ThreadLimit &) = delete;
+  ~ThreadLimit() { detail::thread_limit_arena() = m_previous; }
+
+private:
+  tbb::task_arena m_arena;
+  tbb::task_arena *m_previous;
+};
+
 } // namespace scipp::core::parallel
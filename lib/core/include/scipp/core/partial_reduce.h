@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "scipp/common/index.h"
+#include "scipp/core/aligned_allocator.h"
+#include "scipp/core/cache.h"
+#include "scipp/core/parallel.h"
+
+/// Reduction of many inputs into a shared output from multiple threads.
+///
+/// Inputs are split into chunks, each reduced into a private partial result.
+/// Partial results are then merged into the output in a fixed order.
+namespace scipp::core::partial_reduce {
+
+/// Minimum number of inputs per chunk.
+constexpr scipp::index min_inputs_per_chunk = 64 * 1024;
+/// Partial results are only worth their memory and merge cost if there are on
+/// average more inputs than outputs in each chunk.
+constexpr scipp::index min_inputs_per_output = 4;
+/// Upper bound for the number of chunks. Chunks are scheduled over the
+/// available threads, so this is chosen well above the core count of large
+/// nodes to keep all cores busy with room for load balancing. In practice the
+/// number of chunks is bounded by the input size via the limits above.
+constexpr scipp::index max_chunks = 1024;
+
+/// Return the number of chunks for reducing `ninput` inputs into `noutput`
+/// outputs. 1 means that partial results are not worthwhile.
+///
+/// The result depends only on the sizes and not on the number of threads, so
+/// floating-point results are reproducible independent of the thread count.
+inline scipp::index chunk_count(const scipp::index ninput,
+                                const scipp::index noutput) {
+  return std::max(
+      scipp::index{1},
+      std::min({ninput / min_inputs_per_chunk,
+                ninput / (min_inputs_per_output *
+                          std::max(noutput, scipp::index{1})),
+                max_chunks}));
+}
+
+/// Partial results with `size` elements for each of `nchunk` chunks.
+///
+/// Partials start on cache-line boundaries and are padded to full cache lines
+/// to avoid false sharing. Elements are zero-initialized.
+template <class T> class Partials {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  Partials(const scipp::index nchunk, const scipp::index size)
+      : m_size(size), m_stride((size + per_line - 1) / per_line * per_line),
+        m_data(nchunk * m_stride > 0
+                   ? AlignedAllocator<T, Alignment::CacheLine>().allocate(
+                         nchunk * m_stride)
+                   : nullptr) {
+    std::fill_n(m_data.get(), nchunk * m_stride, T{});
+  }
+
+  std::span<T> operator[](const scipp::index chunk) const {
+    return {m_data.get() + chunk * m_stride, static_cast<size_t>(m_size)};
+  }
+
+private:
+  static constexpr scipp::index per_line =
+      std::max<scipp::index>(1, cache::line_size / sizeof(T));
+  struct Free {
+    void operator()(T *ptr) const noexcept {
+      detail::deallocate_aligned_memory(ptr);
+    }
+  };
+  scipp::index m_size;
+  scipp::index m_stride;
+  std::unique_ptr<T[], Free> m_data;
+};
+
+/// Reduce `ninput` inputs into `noutput` outputs using `nchunk` chunks.
+///
+/// `reduce(chunk, begin, end)` must reduce the inputs in [begin, end) into the
+/// partial result of `chunk`. `merge(chunk, begin, end)` must merge the
+/// elements in [begin, end) of the partial result of `chunk` into the output.
+/// Chunks are reduced in parallel. Merging is parallel over outputs, with
+/// chunks in a fixed order, i.e., the result does not depend on scheduling.
+template <class Reduce, class Merge>
+void run(const scipp::index nchunk, const scipp::index ninput,
+         const scipp::index noutput, const Reduce &reduce, const Merge &merge) {
+  parallel::parallel_for(
+      parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+        for (auto chunk = range.begin(); chunk != range.end(); ++chunk)
+          reduce(chunk, ninput * chunk / nchunk, ninput * (chunk + 1) / nchunk);
+      });
+  parallel::parallel_for(
+      parallel::blocked_range(0, noutput, 1024), [&](const auto &range) {
+        for (scipp::index chunk = 0; chunk < nchunk; ++chunk)
+          merge(chunk, range.begin(), range.end());
+      });
+}
+
+} // namespace scipp::core::partial_reduce
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+
+/// Per-thread scratch buffers for kernels.
+///
+/// Kernels such as those used for binning need temporary buffers whose size
+/// depends on the input. Allocating these on every call churns the allocator,
+/// since kernels run once per TBB task. A `Lease<T>` instead provides a
+/// thread-local object of type `T` that keeps its capacity across calls on the
+/// same thread. Buffers exceeding `retain_limit` bytes are released when the
+/// lease ends, so the memory held by idle threads is bounded.
+namespace scipp::core::scratch {
+
+/// Total number of bytes currently held by scratch buffers of all threads.
+SCIPP_CORE_EXPORT scipp::index allocated_bytes() noexcept;
+/// Maximum number of bytes retained by a single scratch buffer between calls.
+SCIPP_CORE_EXPORT std::size_t retain_limit() noexcept;
+SCIPP_CORE_EXPORT void set_retain_limit(std::size_t bytes) noexcept;
+
+namespace detail {
+SCIPP_CORE_EXPORT void add_allocated_bytes(scipp::index bytes) noexcept;
+
+template <class T> scipp::index capacity_bytes(const T &) { return 0; }
+template <class T> scipp::index capacity_bytes(const std::vector<T> &v);
+template <class... Ts>
+scipp::index capacity_bytes(const std::tuple<Ts...> &t) {
+  return std::apply(
+      [](const auto &...x) { return (capacity_bytes(x) + ... + 0); }, t);
+}
+template <class T> scipp::index capacity_bytes(const std::vector<T> &v) {
+  auto bytes = static_cast<scipp::index>(v.capacity() * sizeof(T));
+  for (const auto &x : v)
+    bytes += capacity_bytes(x);
+  return bytes;
+}
+
+template <class T> struct Slot {
+  Slot() = default;
+  Slot(const Slot &) = delete;
+  Slot &operator=(const Slot &) = delete;
+  ~Slot() { add_allocated_bytes(-bytes); }
+  T value{};
+  scipp::index bytes{0};
+  bool in_use{false};
+};
+
+template <class T> Slot<T> &thread_slot() {
+  static thread_local Slot<T> slot;
+  return slot;
+}
+} // namespace detail
+
+/// Exclusive access to the calling thread's scratch object of type `T`.
+///
+/// The object is *not* cleared when leased, callers must reset the parts they
+/// use. If the thread's object is already leased, e.g., in nested kernel calls,
+/// a temporary object is used instead.
+template <class T> class Lease {
+public:
+  Lease() {
+    auto &slot = detail::thread_slot<T>();
+    if (slot.in_use) {
+      m_owned = std::make_unique<T>();
+      m_value = m_owned.get();
+    } else {
+      slot.in_use = true;
+      m_slot = &slot;
+      m_value = &slot.value;
+    }
+  }
+  Lease(const Lease &) = delete;
+  Lease &operator=(const Lease &) = delete;
+  ~Lease() {
+    if (!m_slot)
+      return;
+    auto bytes = detail::capacity_bytes(m_slot->value);
+    if (bytes > static_cast<scipp::index>(retain_limit())) {
+      m_slot->value = T{};
+      bytes = detail::capacity_bytes(m_slot->value);
+    }
+    detail::add_allocated_bytes(bytes - m_slot->bytes);
+    m_slot->bytes = bytes;
+    m_slot->in_use = false;
+  }
+
+  T &operator*() const noexcept { return *m_value; }
+  T *operator->() const noexcept { return m_value; }
+
+private:
+  detail::Slot<T> *m_slot{nullptr};
+  std::unique_ptr<T> m_owned;
+  T *m_value{nullptr};
+};
+
+} // namespace scipp::core::scratch
@@ -23,7 +23,9 @@
 
 namespace scipp::core {
 
-/// Maximum number of dimensions supported by transform-based operations
+/// Number of dimensions supported by transform-based operations without heap
+/// allocation. Contiguous dimensions are flattened before counting. Operations
+/// with more dimensions are supported but allocate.
 constexpr int32_t NDIM_OP_MAX = 6;
 /// Number of dimension labels/sizes/strides storable without heap allocation
 constexpr int32_t NDIM_STACK = 4;
@@ -5,7 +5,16 @@
 #pragma once
 
 #include <string>
-#include <vector>
+
+// Warnings are raised by boost small_vector with gcc12
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+#include <boost/container/small_vector.hpp>
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
 
 #include "scipp-core_export.h"
 #include "scipp/common/index.h"
@@ -13,10 +22,18 @@
 
 namespace scipp::core {
 
+/// Number of subbin sizes storable without heap allocation.
+///
+/// When rebinning binned data each input bin typically maps to only a few
+/// output bins, so the sizes of most instances fit into the inline buffer. This
+/// avoids one heap allocation per input bin for every intermediate result.
+constexpr int32_t SUBBIN_SIZES_STACK = 4;
+
 /// Helper of `bin` for representing rows of a sparse subbin-size array.
 class SCIPP_CORE_EXPORT SubbinSizes {
 public:
-  using container_type = std::vector<scipp::index>;
+  using container_type =
+      boost::container::small_vector<scipp::index, SUBBIN_SIZES_STACK>;
   SubbinSizes() = default;
   SubbinSizes(const scipp::index offset, container_type &&sizes);
   const auto &offset() const noexcept { return m_offset; }
@@ -31,6 +48,8 @@ public:
   void exclusive_scan(SubbinSizes &x);
 
 private:
+  void cover(const SubbinSizes &other);
+
   scipp::index m_offset{0};
   container_type m_sizes;
 };
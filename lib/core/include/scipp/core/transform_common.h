@@ -124,6 +124,15 @@ struct force_variance_broadcast_t : Flag {};
 /// explicitly broadcasted inputs, even in the presence of variances.
 constexpr auto force_variance_broadcast = force_variance_broadcast_t{};
 
+struct batch_t : Flag {};
+/// Add this to overloaded operator to indicate that the operator processes an
+/// entire inner loop at once instead of a single element. It is then called as
+/// `op(n, strides, pointers...)` with pointers to the first element of the
+/// output and the inputs, and the inner strides of these in units of elements.
+/// The operator must still provide an overload for single elements, which
+/// defines the output dtype but is never called.
+constexpr auto batch = batch_t{};
+
 } // namespace
 } // namespace transform_flags
 
@@ -4,6 +4,11 @@
 /// @author Jan-Lukas Wynen
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
 #include "scipp-core_export.h"
 #include "scipp/common/index_composition.h"
 #include "scipp/core/dimensions.h"
@@ -17,19 +22,31 @@
 namespace scipp::core {
 
 /// A flat index into a multi-dimensional view.
+///
+/// The innermost NDIM_OP_MAX dimensions after flattening are handled using
+/// std::array. Views with more dimensions additionally keep the outer
+/// dimensions on the heap, their memory offset is only recomputed when the
+/// inner dimensions wrap around.
 class SCIPP_CORE_EXPORT ViewIndex {
 public:
   ViewIndex(const Dimensions &target_dimensions, const Strides &strides);
 
-  constexpr void increment_outer() noexcept {
+  void increment_outer() noexcept {
     for (scipp::index d = 0;
          (d < NDIM_OP_MAX - 1) && (m_coord[d] == m_shape[d]); ++d) {
       m_memory_index += m_delta[d + 1];
       ++m_coord[d + 1];
       m_coord[d] = 0;
     }
+    if (m_outer && m_coord[NDIM_OP_MAX - 1] == m_shape[NDIM_OP_MAX - 1]) {
+      // The inner dims wrapped around, move to the next block of outer dims.
+      // m_view_index has not been incremented yet.
+      m_coord[NDIM_OP_MAX - 1] = 0;
+      m_memory_index =
+          m_outer->offset((m_view_index + 1) / m_outer->inner_volume);
+    }
   }
-  constexpr void increment() noexcept {
+  void increment() noexcept {
     m_memory_index += m_delta[0];
     ++m_coord[0];
     if (m_coord[0] == m_shape[0])
@@ -39,10 +56,21 @@ public:
 
   void set_index(const scipp::index index) noexcept {
     m_view_index = index;
-    extract_indices(index, m_shape.begin(), m_shape.begin() + m_ndim,
+    scipp::index inner_index = index;
+    scipp::index outer_offset = 0;
+    if (m_outer) {
+      // The inner volume is 0 only if the view is empty.
+      const auto inner_volume =
+          std::max(m_outer->inner_volume, scipp::index{1});
+      inner_index = index % inner_volume;
+      outer_offset = m_outer->offset(index / inner_volume);
+    }
+    extract_indices(inner_index, m_shape.begin(), m_shape.begin() + m_ndim,
                     m_coord.begin());
-    m_memory_index = flat_index_from_strides(
-        m_strides.begin(), m_strides.begin() + m_ndim, m_coord.begin());
+    m_memory_index = flat_index_from_strides(m_strides.begin(),
+                                             m_strides.begin() + m_ndim,
+                                             m_coord.begin()) +
+                     outer_offset;
   }
 
   [[nodiscard]] constexpr scipp::index get() const noexcept {
@@ -60,6 +88,36 @@ public:
   }
 
 private:
+  /// Dimensions outside the innermost NDIM_OP_MAX dimensions.
+  struct OuterDims {
+    /// Memory offset of the start of the block of inner dimensions with
+    /// index `outer_index`.
+    [[nodiscard]] scipp::index offset(scipp::index outer_index) const noexcept {
+      // Same as extract_indices followed by flat_index_from_strides, without
+      // storing the indices.
+      scipp::index offset = 0;
+      const auto ndim = scipp::size(dims);
+      for (scipp::index d = 0; d < ndim - 1; ++d) {
+        if (dims[d].size != 0) {
+          offset += outer_index % dims[d].size * dims[d].stride;
+          outer_index /= dims[d].size;
+        }
+      }
+      return offset + outer_index * dims[ndim - 1].stride;
+    }
+
+    // Sizes and strides are members of a struct rather than plain arrays of
+    // scipp::index. Accesses can thus not alias the state of ViewIndex, which
+    // the compiler can then keep in registers during iteration.
+    struct Dim {
+      scipp::index size;
+      scipp::index stride;
+    };
+    std::vector<Dim> dims;
+    /// Volume of the inner dimensions.
+    scipp::index inner_volume{0};
+  };
+
   /// Index into memory.
   scipp::index m_memory_index{0};
   /// Index in iteration dimensions.
@@ -72,8 +130,11 @@ private:
   std::array<scipp::index, NDIM_OP_MAX> m_shape = {};
   /// Strides in memory.
   std::array<scipp::index, NDIM_OP_MAX> m_strides = {};
-  /// Number of dimensions.
+  /// Number of dimensions handled by the arrays above.
   int32_t m_ndim;
+  /// Dimensions beyond NDIM_OP_MAX, nullptr if there are none. Shared between
+  /// copies since it is never modified after construction.
+  std::shared_ptr<const OuterDims> m_outer;
 };
 // NOTE:
 // We investigated different containers for the m_delta, m_coord & m_extent
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "scipp/core/memory_pool.h"
+
+namespace scipp::core::memory_pool {
+
+namespace {
+
+constexpr std::size_t min_class_bits = 6; // 64 bytes
+constexpr std::size_t classes_per_octave = 4;
+constexpr std::size_t max_class_bits = 48;
+constexpr std::size_t n_classes =
+    (max_class_bits - min_class_bits) * classes_per_octave + 1;
+
+/// Return index of smallest size class that can hold `bytes`.
+std::size_t class_index(const std::size_t bytes) noexcept {
+  if (bytes <= (std::size_t{1} << min_class_bits))
+    return 0;
+  // 2^(k-1) < bytes <= 2^k, split (2^(k-1), 2^k] into 4 equal steps.
+  const std::size_t k = std::bit_width(bytes - 1);
+  const std::size_t step = std::size_t{1} << (k - 3);
+  const std::size_t sub =
+      (bytes - (std::size_t{1} << (k - 1)) + step - 1) / step;
+  return (k - min_class_bits - 1) * classes_per_octave + sub;
+}
+
+std::size_t class_bytes(const std::size_t index) noexcept {
+  if (index == 0)
+    return std::size_t{1} << min_class_bits;
+  const std::size_t k = (index - 1) / classes_per_octave + min_class_bits + 1;
+  const std::size_t sub = (index - 1) % classes_per_octave + 1;
+  return (std::size_t{1} << (k - 1)) + sub * (std::size_t{1} << (k - 3));
+}
+
+void *system_allocate(const std::size_t bytes) {
+  return ::operator new(bytes, std::align_val_t{alignment});
+}
+
+void system_deallocate(void *ptr) noexcept {
+  ::operator delete(ptr, std::align_val_t{alignment});
+}
+
+std::atomic<bool> g_enabled{false};
+std::atomic<std::size_t> g_thread_cache_limit{std::size_t{128} << 20};
+std::atomic<std::size_t> g_largest_class_buffers{4};
+std::atomic<std::size_t> g_largest_class_bytes{0};
+
+void observe_class(const std::size_t bytes) noexcept {
+  auto largest = g_largest_class_bytes.load(std::memory_order_relaxed);
+  while (bytes > largest && !g_largest_class_bytes.compare_exchange_weak(
+                                largest, bytes, std::memory_order_relaxed)) {
+  }
+}
+
+std::atomic<scipp::index> g_hits{0};
+std::atomic<scipp::index> g_misses{0};
+std::atomic<scipp::index> g_bytes_cached{0};
+std::atomic<scipp::index> g_high_water_mark{0};
+
+void add_cached(const scipp::index bytes) noexcept {
+  const auto current =
+      g_bytes_cached.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto high = g_high_water_mark.load(std::memory_order_relaxed);
+  while (current > high && !g_high_water_mark.compare_exchange_weak(
+                               high, current, std::memory_order_relaxed)) {
+  }
+}
+
+void sub_cached(const scipp::index bytes) noexcept {
+  g_bytes_cached.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+class ThreadCache;
+
+/// Registry of all live thread caches, used by `trim`.
+///
+/// Intentionally leaked, since worker threads may outlive static destruction.
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadCache *> caches;
+};
+
+Registry &registry() {
+  static auto *r = new Registry;
+  return *r;
+}
+
+/// Free-lists of one thread.
+///
+/// The mutex is only contended while another thread runs `trim`.
+class ThreadCache {
+public:
+  ThreadCache() {
+    std::lock_guard lock(registry().mutex);
+    registry().caches.push_back(this);
+  }
+  ThreadCache(const ThreadCache &) = delete;
+  ThreadCache &operator=(const ThreadCache &) = delete;
+  ~ThreadCache() {
+    {
+      std::lock_guard lock(registry().mutex);
+      auto &caches = registry().caches;
+      caches.erase(std::find(caches.begin(), caches.end(), this));
+    }
+    clear();
+  }
+
+  void *pop(const std::size_t index) noexcept {
+    std::lock_guard lock(m_mutex);
+    auto &list = m_free[index];
+    if (list.empty())
+      return nullptr;
+    void *ptr = list.back();
+    list.pop_back();
+    m_bytes -= class_bytes(index);
+    sub_cached(static_cast<scipp::index>(class_bytes(index)));
+    return ptr;
+  }
+
+  bool push(void *ptr, const std::size_t index) noexcept {
+    const auto bytes = class_bytes(index);
+    std::lock_guard lock(m_mutex);
+    if (m_bytes + bytes > effective_thread_cache_limit())
+      return false;
+    try {
+      m_free[index].push_back(ptr);
+    } catch (...) { // allocation of free-list storage failed
+      return false;
+    }
+    m_bytes += bytes;
+    add_cached(static_cast<scipp::index>(bytes));
+    return true;
+  }
+
+  void clear() noexcept {
+    std::lock_guard lock(m_mutex);
+    for (std::size_t index = 0; index < n_classes; ++index) {
+      for (void *ptr : m_free[index])
+        system_deallocate(ptr);
+      sub_cached(static_cast<scipp::index>(class_bytes(index) *
+                                           m_free[index].size()));
+      m_free[index].clear();
+      m_free[index].shrink_to_fit();
+    }
+    m_bytes = 0;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::size_t m_bytes{0};
+  std::array<std::vector<void *>, n_classes> m_free;
+};
+
+enum class CacheState { Uninitialized, Alive, Destroyed };
+// Trivially destructible, so this remains valid after `cache` is destroyed,
+// e.g., when static element_array objects are freed after thread exit.
+thread_local CacheState t_state{CacheState::Uninitialized};
+
+struct CacheHolder {
+  CacheHolder() { t_state = CacheState::Alive; }
+  ~CacheHolder() { t_state = CacheState::Destroyed; }
+  ThreadCache cache;
+};
+
+ThreadCache *thread_cache() noexcept {
+  if (t_state == CacheState::Destroyed)
+    return nullptr;
+  try {
+    static thread_local CacheHolder holder;
+    return &holder.cache;
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+} // namespace
+
+bool is_enabled() noexcept { return g_enabled.load(std::memory_order_relaxed); }
+
+void set_enabled(const bool enabled) {
+  g_enabled.store(enabled, std::memory_order_relaxed);
+  if (!enabled)
+    trim();
+}
+
+std::size_t thread_cache_limit() noexcept {
+  return g_thread_cache_limit.load(std::memory_order_relaxed);
+}
+
+void set_thread_cache_limit(const std::size_t bytes) noexcept {
+  g_thread_cache_limit.store(bytes, std::memory_order_relaxed);
+}
+
+std::size_t largest_class_buffers() noexcept {
+  return g_largest_class_buffers.load(std::memory_order_relaxed);
+}
+
+void set_largest_class_buffers(const std::size_t count) noexcept {
+  g_largest_class_buffers.store(count, std::memory_order_relaxed);
+}
+
+std::size_t effective_thread_cache_limit() noexcept {
+  const auto count = largest_class_buffers();
+  const auto largest = g_largest_class_bytes.load(std::memory_order_relaxed);
+  const auto scaled =
+      count != 0 && largest > std::numeric_limits<std::size_t>::max() / count
+          ? std::numeric_limits<std::size_t>::max()
+          : largest * count;
+  return std::max(thread_cache_limit(), scaled);
+}
+
+std::size_t size_class_bytes(const std::size_t bytes) noexcept {
+  return class_bytes(class_index(bytes));
+}
+
+void *allocate(const std::size_t bytes) {
+  const auto index = class_index(bytes);
+  if (index >= n_classes)
+    throw std::bad_alloc();
+  if (auto *cache = thread_cache(); cache && is_enabled()) {
+    observe_class(class_bytes(index));
+    if (void *ptr = cache->pop(index)) {
+      g_hits.fetch_add(1, std::memory_order_relaxed);
+      return ptr;
+    }
+  }
+  g_misses.fetch_add(1, std::memory_order_relaxed);
+  return system_allocate(class_bytes(index));
+}
+
+void deallocate(void *ptr, const std::size_t bytes) noexcept {
+  if (ptr == nullptr)
+    return;
+  const auto index = class_index(bytes);
+  if (auto *cache = thread_cache(); cache && is_enabled())
+    if (cache->push(ptr, index))
+      return;
+  system_deallocate(ptr);
+}
+
+void trim() noexcept {
+  std::lock_guard lock(registry().mutex);
+  for (auto *cache : registry().caches)
+    cache->clear();
+  g_largest_class_bytes.store(0, std::memory_order_relaxed);
+}
+
+Statistics statistics() noexcept {
+  return {g_hits.load(std::memory_order_relaxed),
+          g_misses.load(std::memory_order_relaxed),
+          g_bytes_cached.load(std::memory_order_relaxed),
+          g_high_water_mark.load(std::memory_order_relaxed)};
+}
+
+void reset_statistics() noexcept {
+  g_hits.store(0, std::memory_order_relaxed);
+  g_misses.store(0, std::memory_order_relaxed);
+  g_high_water_mark.store(g_bytes_cached.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+}
+
+} // namespace scipp::core::memory_pool
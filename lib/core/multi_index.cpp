@@ -3,6 +3,8 @@
 /// @file
 /// @author Simon Heybrock
 
+#include <algorithm>
+
 #include "scipp/core/multi_index.h"
 #include "scipp-core_export.h"
 #include "scipp/core/except.h"
@@ -58,12 +60,6 @@ auto get_slice_dim(const T &param, const Ts &...params) {
   return param ? param.dim : get_slice_dim(params...);
 }
 
-template <class T>
-[[nodiscard]] auto make_span(T &&array, const scipp::index begin) {
-  return std::span{array.data() + begin,
-                   static_cast<size_t>(NDIM_OP_MAX - begin)};
-}
-
 template <class StridesArg>
 [[nodiscard]] scipp::index value_or_default(const StridesArg &strides,
                                             const scipp::index i) {
@@ -86,50 +82,109 @@ bool can_be_flattened(
 // because they are sliced by that dim and their layout changes depending on
 // the current bin.
 // But the inner dimensions always have the same layout.
-template <class... StridesArgs>
-[[nodiscard]] scipp::index
-flatten_dims(const std::span<std::array<scipp::index, sizeof...(StridesArgs)>>
-                 &out_strides,
-             const std::span<scipp::index> &out_shape, const Dimensions &dims,
-             const scipp::index non_flattenable_dim,
-             const StridesArgs &...strides) {
+// Dimensions of length 1 are dropped where flattening is allowed, since they
+// do not contribute to the iteration, regardless of their strides.
+// Flattened dims are appended to out_strides and out_shape, the number of
+// appended dims is returned.
+template <class OutStrides, class OutShape, class... StridesArgs>
+[[nodiscard]] scipp::index flatten_dims(OutStrides &out_strides,
+                                        OutShape &out_shape,
+                                        const Dimensions &dims,
+                                        const scipp::index non_flattenable_dim,
+                                        const StridesArgs &...strides) {
   constexpr scipp::index N = sizeof...(StridesArgs);
   std::array strides_array{std::ref(strides)...};
   std::array<scipp::index, N> strides_for_contiguous{};
   scipp::index dim_write = 0;
   for (scipp::index dim_read = dims.ndim() - 1; dim_read >= 0; --dim_read) {
-    if (dim_write >= static_cast<scipp::index>(out_shape.size()))
-      throw std::runtime_error("Operations with more than " +
-                               std::to_string(NDIM_OP_MAX) +
-                               " dimensions are not supported. "
-                               "For binned data, the combined bin+event "
-                               "dimensions count");
     const auto size = dims.size(dim_read);
-    if (dim_read > non_flattenable_dim &&
-        dim_write > 0 && // need to write at least one inner dim
+    const bool flattenable =
+        dim_read > non_flattenable_dim &&
+        dim_write > 0; // need to write at least one inner dim
+    if (flattenable && size == 1)
+      continue;
+    if (flattenable &&
         can_be_flattened(dim_read, size, std::make_index_sequence<N>{},
                          strides_for_contiguous, strides...)) {
-      out_shape[dim_write - 1] *= size;
+      out_shape.back() *= size;
     } else {
-      out_shape[dim_write] = size;
+      out_shape.push_back(size);
+      auto &out = out_strides.emplace_back();
       for (scipp::index data = 0; data < N; ++data) {
-        out_strides[dim_write][data] =
-            value_or_default(strides_array[data].get(), dim_read);
+        out[data] = value_or_default(strides_array[data].get(), dim_read);
+        strides_for_contiguous[data] = size * out[data];
       }
       ++dim_write;
     }
   }
   return dim_write;
 }
+/// Reorder and merge the flattened dims of dense operands.
+///
+/// If the first operand (the output of a transform) has no zero strides,
+/// every element of it is visited exactly once. The iteration order is then
+/// irrelevant and dims are ordered by increasing stride of the first operand,
+/// i.e., such that the output is traversed in memory order. Adjacent dims
+/// whose strides are compatible in all operands are merged afterwards, which
+/// maximizes the length of the inner loop. Otherwise, e.g., when accumulating
+/// into an output with stride zero, the order must be preserved and only
+/// merging is performed.
+/// Returns the new number of dims.
+template <class OutStrides, class OutShape>
+[[nodiscard]] scipp::index coalesce_dims(OutStrides &strides,
+                                         OutShape &shape) noexcept {
+  const auto ndim = scipp::size(shape);
+  if (ndim < 2)
+    return ndim;
+  const bool reorder = std::none_of(
+      strides.begin(), strides.end(),
+      [](const auto &dim_strides) { return dim_strides[0] == 0; });
+  if (reorder) {
+    // Insertion sort since ndim is small. This is stable, so dims with equal
+    // strides keep their relative order.
+    for (scipp::index i = 1; i < ndim; ++i)
+      for (scipp::index j = i; j > 0 && strides[j - 1][0] > strides[j][0];
+           --j) {
+        std::swap(strides[j - 1], strides[j]);
+        std::swap(shape[j - 1], shape[j]);
+      }
+  }
+  scipp::index dim_write = 0;
+  for (scipp::index dim_read = 1; dim_read < ndim; ++dim_read) {
+    bool contiguous = true;
+    for (size_t data = 0; data < strides[dim_read].size(); ++data)
+      contiguous &= strides[dim_read][data] ==
+                    strides[dim_write][data] * shape[dim_write];
+    if (shape[dim_read] == 1) {
+      continue;
+    } else if (contiguous || shape[dim_write] == 1) {
+      // A leading dim of length 1 is replaced rather than merged.
+      if (!contiguous)
+        strides[dim_write] = strides[dim_read];
+      shape[dim_write] *= shape[dim_read];
+    } else {
+      ++dim_write;
+      strides[dim_write] = strides[dim_read];
+      shape[dim_write] = shape[dim_read];
+    }
+  }
+  strides.resize(dim_write + 1);
+  shape.resize(dim_write + 1);
+  return dim_write + 1;
+}
 } // namespace
 
 template <scipp::index N>
 template <class... StridesArgs>
 MultiIndex<N>::MultiIndex(const Dimensions &iter_dims,
                           const StridesArgs &...strides)
-    : m_ndim{flatten_dims(make_span(m_stride, 0), make_span(m_shape, 0),
-                          iter_dims, 0, strides...)},
-      m_inner_ndim{m_ndim} {}
+    : m_ndim{flatten_dims(m_stride, m_shape, iter_dims, 0, strides...)} {
+  // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
+  m_ndim = coalesce_dims(m_stride, m_shape);
+  // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
+  m_inner_ndim = m_ndim;
+  pad_dims();
+}
 
 template <scipp::index N>
 template <class... Params>
@@ -142,13 +197,12 @@ MultiIndex<N>::MultiIndex(binned_tag, const Dimensions &inner_dims,
 
   // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
   m_inner_ndim = flatten_dims(
-      make_span(m_stride, 0), make_span(m_shape, 0), inner_dims,
-      inner_dims.index(slice_dim),
+      m_stride, m_shape, inner_dims, inner_dims.index(slice_dim),
       params.bucketParams() ? params.bucketParams().strides : Strides{}...);
   // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
-  m_ndim = m_inner_ndim + flatten_dims(make_span(m_stride, m_inner_ndim),
-                                       make_span(m_shape, m_inner_ndim),
-                                       bin_dims, 0, params.strides()...);
+  m_ndim = m_inner_ndim +
+           flatten_dims(m_stride, m_shape, bin_dims, 0, params.strides()...);
+  pad_dims();
 
   // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
   m_nested_dim_index = m_inner_ndim - inner_dims.index(slice_dim) - 1;
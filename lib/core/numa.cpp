@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "scipp/core/numa.h"
+#include "scipp/core/parallel.h"
+
+namespace scipp::core::numa {
+
+namespace {
+std::atomic<Policy> g_policy{Policy::Default};
+
+/// IDs of all memory nodes. Node IDs are not necessarily contiguous.
+const std::vector<int> &node_ids() {
+  static const std::vector<int> ids = [] {
+    std::vector<int> result;
+#ifdef __linux__
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(
+             "/sys/devices/system/node", ec)) {
+      const auto name = entry.path().filename().string();
+      if (name.size() > 4 && name.compare(0, 4, "node") == 0 &&
+          name.find_first_not_of("0123456789", 4) == std::string::npos)
+        result.push_back(std::stoi(name.substr(4)));
+    }
+#endif
+    return result;
+  }();
+  return ids;
+}
+
+std::size_t page_size() noexcept {
+#ifdef __linux__
+  static const auto size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+#else
+  return 4096;
+#endif
+}
+
+std::uintptr_t round_up(const std::uintptr_t addr,
+                        const std::size_t page) noexcept {
+  return (addr + page - 1) / page * page;
+}
+
+/// Write the first byte of every page starting in the byte range of each
+/// sub-range, such that it is faulted in by the thread processing it.
+void first_touch(std::byte *ptr, const scipp::index size,
+                 const std::size_t element_size) {
+  const auto page = page_size();
+  const auto base = reinterpret_cast<std::uintptr_t>(ptr);
+  parallel::static_parallel_for(
+      parallel::blocked_range(0, size), [&](const auto &range) {
+        const auto end = base + range.end() * element_size;
+        // The partial first page belongs to the sub-range containing byte 0.
+        auto addr = range.begin() == 0
+                        ? base
+                        : round_up(base + range.begin() * element_size, page);
+        for (; addr < end; addr = (addr / page + 1) * page)
+          ptr[addr - base] = std::byte{0};
+      });
+}
+
+#ifdef __linux__
+void interleave(std::byte *ptr, const std::size_t bytes) noexcept {
+  constexpr int mpol_interleave = 3;
+  constexpr std::size_t bits = 8 * sizeof(unsigned long);
+  const auto &ids = node_ids();
+  int max_id = 0;
+  for (const auto id : ids)
+    max_id = std::max(max_id, id);
+  std::vector<unsigned long> mask(max_id / bits + 1, 0);
+  for (const auto id : ids)
+    mask[id / bits] |= 1ul << (id % bits);
+  // mbind requires a page-aligned start. Partial pages at either end are left
+  // to the default policy.
+  const auto page = page_size();
+  const auto base = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto begin = round_up(base, page);
+  const auto end = (base + bytes) / page * page;
+  if (end <= begin)
+    return;
+  // Failure is not an error, the buffer is merely not interleaved.
+  static_cast<void>(syscall(SYS_mbind, begin, end - begin, mpol_interleave,
+                            mask.data(), mask.size() * bits + 1, 0));
+}
+#endif
+} // namespace
+
+scipp::index node_count() noexcept {
+  try {
+    return std::max(scipp::index(1), scipp::size(node_ids()));
+  } catch (...) {
+    return 1;
+  }
+}
+
+Policy policy() noexcept { return g_policy.load(std::memory_order_relaxed); }
+
+void set_policy(const Policy policy) noexcept {
+  g_policy.store(policy, std::memory_order_relaxed);
+}
+
+bool first_touch_active() noexcept {
+  return policy() == Policy::FirstTouch && node_count() > 1;
+}
+
+void place(void *ptr, const scipp::index size,
+           const std::size_t element_size) noexcept {
+  const auto current = policy();
+  const auto bytes = size * element_size;
+  if (current == Policy::Default || ptr == nullptr ||
+      bytes < min_place_bytes || node_count() <= 1)
+    return;
+  try {
+    if (current == Policy::FirstTouch)
+      first_touch(static_cast<std::byte *>(ptr), size, element_size);
+#ifdef __linux__
+    else
+      interleave(static_cast<std::byte *>(ptr), bytes);
+#endif
+  } catch (...) {
+    // Placement is an optimization only.
+  }
+}
+
+} // namespace scipp::core::numa
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/parallel.h"
+
+namespace scipp::core::parallel::detail {
+
+tbb::task_arena *&thread_limit_arena() noexcept {
+  // Defined out of line such that all libraries share the same instance.
+  thread_local tbb::task_arena *arena = nullptr;
+  return arena;
+}
+
+} // namespace scipp::core::parallel::detail
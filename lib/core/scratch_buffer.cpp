@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <atomic>
+
+#include "scipp/core/scratch_buffer.h"
+
+namespace scipp::core::scratch {
+
+namespace {
+std::atomic<scipp::index> g_allocated_bytes{0};
+std::atomic<std::size_t> g_retain_limit{std::size_t{64} << 20};
+} // namespace
+
+scipp::index allocated_bytes() noexcept {
+  return g_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+std::size_t retain_limit() noexcept {
+  return g_retain_limit.load(std::memory_order_relaxed);
+}
+
+void set_retain_limit(const std::size_t bytes) noexcept {
+  g_retain_limit.store(bytes, std::memory_order_relaxed);
+}
+
+void detail::add_allocated_bytes(const scipp::index bytes) noexcept {
+  g_allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+} // namespace scipp::core::scratch
@@ -23,20 +23,34 @@ void SubbinSizes::operator=(const scipp::index value) {
     size = value;
 }
 
-SubbinSizes &SubbinSizes::operator+=(const SubbinSizes &other) {
-  if (other.offset() < offset()) // avoid realloc if possible
-    return *this = *this + other;
-  scipp::index current = other.offset() - offset();
-  const auto length = current + scipp::size(other.sizes());
+/// Grow the range of subbins such that it includes the range of `other`.
+///
+/// Operates in-place, no allocation occurs unless the new size exceeds the
+/// current capacity.
+void SubbinSizes::cover(const SubbinSizes &other) {
+  if (other.offset() < offset()) {
+    m_sizes.insert(m_sizes.begin(), offset() - other.offset(), 0);
+    m_offset = other.offset();
+  }
+  const auto length = other.offset() - offset() + scipp::size(other.sizes());
   if (length > scipp::size(sizes()))
     m_sizes.resize(length);
+}
+
+SubbinSizes &SubbinSizes::operator+=(const SubbinSizes &other) {
+  cover(other);
+  scipp::index current = other.offset() - offset();
   for (const auto &x : other.sizes())
     m_sizes[current++] += x;
   return *this;
 }
 
 SubbinSizes &SubbinSizes::operator-=(const SubbinSizes &other) {
-  return *this = *this - other;
+  cover(other);
+  scipp::index current = other.offset() - offset();
+  for (const auto &x : other.sizes())
+    m_sizes[current++] -= x;
+  return *this;
 }
 
 SubbinSizes SubbinSizes::cumsum_exclusive() const {
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "scipp/core/argsort.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+template <class T>
+void expect_sorted_stable(const std::vector<T> &keys,
+                          const std::vector<scipp::index> &perm,
+                          const SortOrder order) {
+  ASSERT_EQ(perm.size(), keys.size());
+  for (size_t i = 1; i < perm.size(); ++i) {
+    const auto &a = keys[perm[i - 1]];
+    const auto &b = keys[perm[i]];
+    if (order == SortOrder::Ascending)
+      ASSERT_FALSE(b < a);
+    else
+      ASSERT_FALSE(a < b);
+    if (!(a < b) && !(b < a))
+      ASSERT_LT(perm[i - 1], perm[i]);
+  }
+}
+
+template <class T> std::vector<T> random_keys(const size_t size) {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<T> keys(size);
+  for (auto &key : keys)
+    key = static_cast<T>(dist(rng));
+  return keys;
+}
+} // namespace
+
+template <class T> class ArgsortTest : public ::testing::Test {};
+using ArgsortTypes = ::testing::Types<double, float, int64_t, int32_t>;
+TYPED_TEST_SUITE(ArgsortTest, ArgsortTypes);
+
+TYPED_TEST(ArgsortTest, empty) {
+  const std::vector<TypeParam> keys;
+  EXPECT_TRUE(argsort(std::span<const TypeParam>(keys)).empty());
+}
+
+TYPED_TEST(ArgsortTest, small) {
+  const std::vector<TypeParam> keys{3, -1, 2, -1, 0};
+  EXPECT_EQ(argsort(std::span<const TypeParam>(keys)),
+            (std::vector<scipp::index>{1, 3, 4, 2, 0}));
+  EXPECT_EQ(argsort(std::span<const TypeParam>(keys), SortOrder::Descending),
+            (std::vector<scipp::index>{0, 2, 4, 1, 3}));
+}
+
+TYPED_TEST(ArgsortTest, large_is_stable) {
+  // Large enough for multiple chunks of the radix sort.
+  const auto keys = random_keys<TypeParam>(300000);
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending})
+    expect_sorted_stable(keys, argsort(std::span<const TypeParam>(keys), order),
+                         order);
+}
+
+TYPED_TEST(ArgsortTest, ranges) {
+  // Overlapping ranges, out of order, short and long enough for radix sort.
+  const auto keys = random_keys<TypeParam>(10000);
+  const std::vector<scipp::index_pair> ranges{
+      {5000, 10000}, {0, 0}, {3, 10}, {0, 6000}, {7, 9}};
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    const auto perm =
+        argsort(std::span<const TypeParam>(keys),
+                std::span<const scipp::index_pair>(ranges), order);
+    ASSERT_EQ(scipp::size(perm), 5000 + 7 + 6000 + 2);
+    auto offset = perm.begin();
+    for (const auto &[begin, end] : ranges) {
+      std::vector<scipp::index> expected(end - begin);
+      std::iota(expected.begin(), expected.end(), begin);
+      std::stable_sort(expected.begin(), expected.end(),
+                       [&](const auto a, const auto b) {
+                         return order == SortOrder::Ascending
+                                    ? keys[a] < keys[b]
+                                    : keys[b] < keys[a];
+                       });
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(), offset));
+      offset += end - begin;
+    }
+  }
+}
+
+TEST(ArgsortTest, float_special_values) {
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> keys{1.0, nan, -inf, -0.0, inf, 0.0, -nan, -2.5};
+  keys.resize(4000, 0.5); // Force radix sort
+  const auto perm = argsort(std::span<const double>(keys));
+  EXPECT_EQ(perm[0], 2);
+  EXPECT_EQ(perm[1], 7);
+  // -0.0 and 0.0 are equal, so their order is preserved.
+  EXPECT_EQ(perm[2], 3);
+  EXPECT_EQ(perm[3], 5);
+  EXPECT_EQ(perm[keys.size() - 4], 0);
+  EXPECT_EQ(perm[keys.size() - 3], 4);
+  EXPECT_TRUE(std::isnan(keys[perm[keys.size() - 2]]));
+  EXPECT_TRUE(std::isnan(keys[perm[keys.size() - 1]]));
+  const auto descending =
+      argsort(std::span<const double>(keys), SortOrder::Descending);
+  EXPECT_TRUE(std::isnan(keys[descending[0]]));
+  EXPECT_TRUE(std::isnan(keys[descending[1]]));
+  EXPECT_EQ(descending[2], 4);
+  EXPECT_EQ(descending[keys.size() - 1], 2);
+}
+
+TEST(ArgsortTest, int64_extremes) {
+  std::vector<int64_t> keys{0, std::numeric_limits<int64_t>::max(), -1,
+                            std::numeric_limits<int64_t>::min(), 1};
+  keys.resize(4000, 2);
+  const auto perm = argsort(std::span<const int64_t>(keys));
+  EXPECT_EQ(perm[0], 3);
+  EXPECT_EQ(perm[1], 2);
+  EXPECT_EQ(perm[2], 0);
+  EXPECT_EQ(perm[3], 4);
+  EXPECT_EQ(perm[keys.size() - 1], 1);
+}
+
+TEST(ArgsortTest, time_point) {
+  std::vector<time_point> keys;
+  for (const auto t : random_keys<int64_t>(5000))
+    keys.emplace_back(t);
+  expect_sorted_stable(keys, argsort(std::span<const time_point>(keys)),
+                       SortOrder::Ascending);
+}
+
+TEST(ArgsortTest, bool) {
+  const std::array<bool, 5> keys{true, false, true, false, false};
+  EXPECT_EQ(argsort(std::span<const bool>(keys)),
+            (std::vector<scipp::index>{1, 3, 4, 0, 2}));
+}
+
+TEST(ArgsortTest, string) {
+  const std::vector<std::string> keys{"b", "a", "c", "a"};
+  EXPECT_EQ(argsort(std::span<const std::string>(keys)),
+            (std::vector<scipp::index>{1, 3, 0, 2}));
+  EXPECT_EQ(argsort(std::span<const std::string>(keys), SortOrder::Descending),
+            (std::vector<scipp::index>{2, 0, 1, 3}));
+}
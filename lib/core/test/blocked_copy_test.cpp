@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/blocked_copy.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+using Shape = std::vector<scipp::index>;
+
+Shape contiguous_strides(const Shape &shape) {
+  Shape strides(shape.size());
+  scipp::index stride = 1;
+  for (auto d = scipp::size(shape) - 1; d >= 0; --d) {
+    strides[d] = stride;
+    stride *= shape[d];
+  }
+  return strides;
+}
+
+/// Strides of an array with dims in the given order, in the order of `shape`.
+Shape permuted_strides(const Shape &shape, const Shape &order) {
+  Shape permuted_shape;
+  for (const auto d : order)
+    permuted_shape.push_back(shape[d]);
+  const auto permuted = contiguous_strides(permuted_shape);
+  Shape strides(shape.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    strides[order[i]] = permuted[i];
+  return strides;
+}
+
+void naive_copy(const double *src, double *dst, const Shape &shape,
+                const Shape &src_strides, const Shape &dst_strides) {
+  const auto volume = std::accumulate(shape.begin(), shape.end(),
+                                      scipp::index{1}, std::multiplies{});
+  Shape coord(shape.size(), 0);
+  for (scipp::index i = 0; i < volume; ++i) {
+    scipp::index s = 0;
+    scipp::index t = 0;
+    for (size_t d = 0; d < shape.size(); ++d) {
+      s += coord[d] * src_strides[d];
+      t += coord[d] * dst_strides[d];
+    }
+    dst[t] = src[s];
+    for (auto d = scipp::size(shape) - 1; d >= 0; --d) {
+      if (++coord[d] < shape[d])
+        break;
+      coord[d] = 0;
+    }
+  }
+}
+
+void check(const Shape &shape, const Shape &src_strides,
+           const Shape &dst_strides, const scipp::index buffer_size) {
+  std::vector<double> src(buffer_size);
+  std::iota(src.begin(), src.end(), 1.0);
+  std::vector<double> expected(buffer_size, 0.0);
+  std::vector<double> dst(buffer_size, 0.0);
+  naive_copy(src.data(), expected.data(), shape, src_strides, dst_strides);
+  blocked_copy(src.data(), dst.data(), shape, src_strides, dst_strides);
+  EXPECT_EQ(dst, expected);
+}
+
+scipp::index volume(const Shape &shape) {
+  return std::accumulate(shape.begin(), shape.end(), scipp::index{1},
+                         std::multiplies{});
+}
+} // namespace
+
+TEST(BlockedCopyTest, scalar) {
+  check({}, {}, {}, 1);
+  check({1, 1}, {1, 1}, {1, 1}, 1);
+}
+
+TEST(BlockedCopyTest, empty) {
+  check({0, 7}, {7, 1}, {1, 0}, 0);
+  check({300, 0}, {1, 300}, {0, 1}, 0);
+}
+
+TEST(BlockedCopyTest, contiguous) {
+  const Shape shape{30, 70};
+  check(shape, contiguous_strides(shape), contiguous_strides(shape),
+        volume(shape));
+}
+
+TEST(BlockedCopyTest, transpose_2d) {
+  for (const auto &shape : {Shape{300, 170}, Shape{1, 5000}, Shape{5000, 3},
+                            Shape{1023, 1025}}) {
+    check(shape, permuted_strides(shape, {1, 0}), contiguous_strides(shape),
+          volume(shape));
+    check(shape, contiguous_strides(shape), permuted_strides(shape, {1, 0}),
+          volume(shape));
+  }
+}
+
+TEST(BlockedCopyTest, permute_3d) {
+  const Shape shape{5, 70, 90};
+  Shape order{0, 1, 2};
+  do {
+    check(shape, permuted_strides(shape, order), contiguous_strides(shape),
+          volume(shape));
+  } while (std::next_permutation(order.begin(), order.end()));
+}
+
+TEST(BlockedCopyTest, length_1_dims) {
+  const Shape shape{1, 200, 1, 300, 1};
+  check(shape, permuted_strides(shape, {4, 3, 2, 1, 0}),
+        contiguous_strides(shape), volume(shape));
+}
+
+TEST(BlockedCopyTest, slice_of_transposed) {
+  // Source is a slice of a (300, 400) array with dims transposed.
+  const Shape shape{200, 100};
+  check(shape, {1, 300}, contiguous_strides(shape), 300 * 400);
+}
+
+TEST(BlockedCopyTest, broadcast_source) {
+  const Shape shape{300, 200};
+  check(shape, {1, 0}, contiguous_strides(shape), volume(shape));
+}
+
+TEST(BlockedCopyTest, is_transposing_copy) {
+  const Shape shape{30, 40, 50};
+  const auto contiguous = contiguous_strides(shape);
+  EXPECT_FALSE(is_transposing_copy(shape, contiguous, contiguous));
+  // Outer dims transposed, inner dim contiguous in both.
+  EXPECT_FALSE(is_transposing_copy(shape, permuted_strides(shape, {1, 0, 2}),
+                                   contiguous));
+  EXPECT_TRUE(is_transposing_copy(shape, permuted_strides(shape, {0, 2, 1}),
+                                  contiguous));
+  EXPECT_TRUE(is_transposing_copy(shape, contiguous,
+                                  permuted_strides(shape, {2, 1, 0})));
+  // Slice of the middle dim.
+  EXPECT_FALSE(is_transposing_copy(shape, Shape{40 * 100, 100, 1}, contiguous));
+}
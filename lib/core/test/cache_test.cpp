@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/cache.h"
+
+using namespace scipp::core;
+
+TEST(CacheTest, l2_size_is_plausible) {
+  EXPECT_GE(cache::l2_size(), 64 * 1024);
+  EXPECT_EQ(cache::l2_size() % cache::line_size, 0);
+}
+
+TEST(CacheTest, l2_size_is_stable) {
+  EXPECT_EQ(cache::l2_size(), cache::l2_size());
+}
+
+TEST(CacheTest, set_l2_size) {
+  const auto detected = cache::l2_size();
+  cache::set_l2_size(128 * 1024);
+  EXPECT_EQ(cache::l2_size(), 128 * 1024);
+  cache::set_l2_size(0);
+  EXPECT_EQ(cache::l2_size(), detected);
+}
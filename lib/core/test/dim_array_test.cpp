@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "scipp/common/index_composition.h"
+#include "scipp/core/dim_array.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(DimArrayTest, default_is_empty) {
+  const DimArray<scipp::index, 3> array;
+  EXPECT_EQ(array.size(), 0);
+  EXPECT_EQ(array.begin(), array.end());
+}
+
+TEST(DimArrayTest, resize_value_initializes) {
+  DimArray<scipp::index, 3> array;
+  array.push_back(1);
+  array.push_back(2);
+  array.resize(1);
+  array.resize(5);
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array[0], 1);
+  for (scipp::index i = 1; i < 5; ++i)
+    EXPECT_EQ(array[i], 0);
+}
+
+TEST(DimArrayTest, push_back_beyond_stack) {
+  DimArray<scipp::index, 3> array;
+  for (scipp::index i = 0; i < 7; ++i)
+    array.push_back(10 * i);
+  EXPECT_EQ(array.size(), 7);
+  EXPECT_EQ(array.back(), 60);
+  scipp::index expected = 0;
+  for (const auto x : array) {
+    EXPECT_EQ(x, expected);
+    expected += 10;
+  }
+}
+
+TEST(DimArrayTest, emplace_back_of_arrays) {
+  DimArray<std::array<scipp::index, 2>, 1> array;
+  array.emplace_back()[1] = 1;
+  array.emplace_back()[0] = 2;
+  EXPECT_EQ(array[0], (std::array<scipp::index, 2>{0, 1}));
+  EXPECT_EQ(array[1], (std::array<scipp::index, 2>{2, 0}));
+}
+
+TEST(DimArrayTest, copy) {
+  DimArray<scipp::index, 2> array;
+  for (scipp::index i = 0; i < 4; ++i)
+    array.push_back(i);
+  auto copy = array;
+  EXPECT_EQ(copy, array);
+  copy[3] = 7;
+  EXPECT_NE(copy, array);
+  EXPECT_EQ(array[3], 3);
+}
+
+TEST(DimArrayTest, equality_ignores_elements_beyond_size) {
+  DimArray<scipp::index, 4> a;
+  DimArray<scipp::index, 4> b;
+  a.push_back(1);
+  a.push_back(2);
+  b.push_back(1);
+  b.push_back(3);
+  b.resize(1);
+  a.resize(1);
+  EXPECT_EQ(a, b);
+  b.push_back(2);
+  EXPECT_NE(a, b);
+}
+
+TEST(DimArrayTest, index_composition_across_heap_boundary) {
+  DimArray<scipp::index, 2> shape;
+  DimArray<scipp::index, 2> indices;
+  for (const scipp::index size : {2, 3, 4, 5})
+    shape.push_back(size);
+  indices.resize(4);
+  extract_indices(2 * 3 * 4 * 5 - 1, shape.begin(), shape.end(),
+                  indices.begin());
+  for (scipp::index i = 0; i < 4; ++i)
+    EXPECT_EQ(indices[i], shape[i] - 1);
+}
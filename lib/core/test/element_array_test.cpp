@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "scipp/core/element_array.h"
@@ -182,3 +184,47 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, external) {
+  auto buffer = std::make_shared<std::vector<float>>(
+      std::vector<float>{1.1f, 2.2f, 3.3f});
+  element_array<float> x(buffer->data(), 3, buffer);
+  check_element_array(std::as_const(x));
+  ASSERT_TRUE(x.is_external());
+  // Writable external buffers are shared.
+  x.data()[0] = 4.4f;
+  ASSERT_EQ(x.data(), buffer->data());
+  ASSERT_EQ((*buffer)[0], 4.4f);
+}
+
+TEST(ElementArrayTest, external_keeps_owner_alive) {
+  auto buffer = std::make_shared<std::vector<float>>(3);
+  std::weak_ptr<std::vector<float>> weak(buffer);
+  {
+    element_array<float> x(buffer->data(), 3, buffer);
+    buffer.reset();
+    ASSERT_FALSE(weak.expired());
+    element_array<float> y(std::move(x));
+    ASSERT_FALSE(weak.expired());
+  }
+  ASSERT_TRUE(weak.expired());
+}
+
+TEST(ElementArrayTest, external_reset_releases_owner) {
+  auto buffer = std::make_shared<std::vector<float>>(3);
+  std::weak_ptr<std::vector<float>> weak(buffer);
+  element_array<float> x(buffer->data(), 3, buffer);
+  buffer.reset();
+  x.reset();
+  ASSERT_TRUE(weak.expired());
+}
+
+TEST(ElementArrayTest, external_copy_is_owned) {
+  auto buffer = std::make_shared<std::vector<float>>(
+      std::vector<float>{1.1f, 2.2f, 3.3f});
+  const element_array<float> x(buffer->data(), 3, buffer);
+  const auto y(x);
+  check_element_array(y);
+  ASSERT_FALSE(y.is_external());
+  ASSERT_NE(y.data(), buffer->data());
+}
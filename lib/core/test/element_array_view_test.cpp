@@ -456,3 +456,31 @@ TEST(ElementArrayViewTest, requireContiguous) {
   expect_contiguous({{Dim::Z, Dim::Y, Dim::X}, {2, 3, 4}}, {13, 4, 1},
                     false); // gap between slabs
 }
+
+TEST(ElementArrayViewTest, overlaps) {
+  std::vector<double> data(8);
+  const Dimensions row{Dim::X, 4};
+  const Strides stride{1};
+  const ElementArrayView<double> row0(data.data(), 0, row, stride);
+  const ElementArrayView<double> row1(data.data(), 4, row, stride);
+  const ElementArrayView<double> shifted(data.data(), 2, row, stride);
+  const ElementArrayView<double> column(data.data(), 1, {Dim::Y, 2}, {4});
+  const ElementArrayView<double> empty(data.data(), 2, {Dim::X, 0}, stride);
+  EXPECT_FALSE(row0.overlaps(row0));
+  EXPECT_FALSE(row0.overlaps(row1));
+  EXPECT_FALSE(row1.overlaps(row0));
+  EXPECT_TRUE(row0.overlaps(shifted));
+  EXPECT_TRUE(row1.overlaps(shifted));
+  EXPECT_TRUE(column.overlaps(row0));
+  EXPECT_TRUE(column.overlaps(row1));
+  EXPECT_FALSE(empty.overlaps(row0));
+  EXPECT_FALSE(shifted.overlaps(empty));
+}
+
+TEST(ElementArrayViewTest, overlaps_different_buffer) {
+  std::vector<double> a(4);
+  std::vector<double> b(4);
+  const ElementArrayView<double> view_a(a.data(), 0, {Dim::X, 4}, {1});
+  const ElementArrayView<double> view_b(b.data(), 0, {Dim::X, 4}, {1});
+  EXPECT_FALSE(view_a.overlaps(view_b));
+}
@@ -123,3 +123,44 @@ TEST(ElementHistogramTest, infinite_values_are_dropped_linspace_bins) {
   EXPECT_EQ(result_vals, std::vector<double>({0, 20 + 30, 40}));
   EXPECT_EQ(result_vars, std::vector<double>({0, 200 + 300, 400}));
 }
+
+namespace {
+void check_many_events(const std::vector<double> &edges) {
+  // Enough events to fill a single histogram from multiple threads.
+  const scipp::index size = 300000;
+  std::vector<double> events(size);
+  std::vector<double> weight_vals(size);
+  std::vector<double> weight_vars(size);
+  std::vector<double> expected_vals(edges.size() - 1);
+  std::vector<double> expected_vars(edges.size() - 1);
+  for (scipp::index i = 0; i < size; ++i) {
+    events[i] = static_cast<double>((i * 7919) % 1100) / 10.0 - 2.0;
+    weight_vals[i] = i % 3;
+    weight_vars[i] = i % 5;
+    const auto it = std::upper_bound(edges.begin(), edges.end(), events[i]);
+    if (it != edges.begin() && it != edges.end()) {
+      expected_vals[it - edges.begin() - 1] += weight_vals[i];
+      expected_vars[it - edges.begin() - 1] += weight_vars[i];
+    }
+  }
+  std::vector<double> result_vals(edges.size() - 1);
+  std::vector<double> result_vars(edges.size() - 1);
+  element::histogram(
+      ValueAndVariance(std::span(result_vals), std::span(result_vars)), events,
+      ValueAndVariance(std::span(weight_vals), std::span(weight_vars)), edges);
+  EXPECT_EQ(result_vals, expected_vals);
+  EXPECT_EQ(result_vars, expected_vars);
+}
+} // namespace
+
+TEST(ElementHistogramTest, many_events) {
+  std::vector<double> edges{0, 1, 3, 7, 20, 50, 51, 100};
+  check_many_events(edges);
+}
+
+TEST(ElementHistogramTest, many_events_linspace_bins) {
+  std::vector<double> edges(101);
+  for (size_t i = 0; i < edges.size(); ++i)
+    edges[i] = static_cast<double>(i);
+  check_many_events(edges);
+}
@@ -85,3 +85,28 @@ TEST_P(ElementMapToBinsChunkedTest, direct_equivalent_to_chunkwise) {
   check_direct_equivalent_to_chunkwise<1024>();
   check_direct_equivalent_to_chunkwise<2048>();
 }
+
+TEST_P(ElementMapToBinsChunkedTest, direct_equivalent_to_write_combining) {
+  auto binned1 = binned;
+  auto binned2 = binned;
+  auto bins1 = bins;
+  auto bins2 = bins;
+  map_to_bins_direct(binned1, bins1, data, bin_indices);
+  map_to_bins_write_combining(binned2, bins2, data, bin_indices);
+  EXPECT_EQ(binned1, binned2) << seed;
+  EXPECT_EQ(bins1, bins2) << seed;
+}
+
+TEST_P(ElementMapToBinsChunkedTest,
+       direct_equivalent_to_write_combining_with_variances) {
+  const auto variances = data;
+  const ValueAndVariance<std::vector<double>> in{data, variances};
+  ValueAndVariance<std::vector<double>> binned1{binned, binned};
+  auto binned2 = binned1;
+  auto bins1 = bins;
+  auto bins2 = bins;
+  map_to_bins_direct(binned1, bins1, in, bin_indices);
+  map_to_bins_write_combining(binned2, bins2, in, bin_indices);
+  EXPECT_EQ(binned1.value, binned2.value) << seed;
+  EXPECT_EQ(binned1.variance, binned2.variance) << seed;
+}
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/memory_pool.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class MemoryPoolTest : public ::testing::Test {
+protected:
+  MemoryPoolTest() {
+    memory_pool::set_enabled(true);
+    memory_pool::reset_statistics();
+  }
+  ~MemoryPoolTest() override { memory_pool::set_enabled(false); }
+};
+
+TEST(MemoryPoolSizeClassTest, minimum_class) {
+  EXPECT_EQ(memory_pool::size_class_bytes(0), 64);
+  EXPECT_EQ(memory_pool::size_class_bytes(1), 64);
+  EXPECT_EQ(memory_pool::size_class_bytes(64), 64);
+}
+
+TEST(MemoryPoolSizeClassTest, four_classes_per_power_of_two) {
+  EXPECT_EQ(memory_pool::size_class_bytes(65), 80);
+  EXPECT_EQ(memory_pool::size_class_bytes(80), 80);
+  EXPECT_EQ(memory_pool::size_class_bytes(81), 96);
+  EXPECT_EQ(memory_pool::size_class_bytes(127), 128);
+  EXPECT_EQ(memory_pool::size_class_bytes(128), 128);
+  EXPECT_EQ(memory_pool::size_class_bytes(1000000), 1048576);
+  EXPECT_EQ(memory_pool::size_class_bytes(1048577), 1310720);
+}
+
+TEST(MemoryPoolSizeClassTest, overhead_is_bounded) {
+  for (std::size_t bytes = 65; bytes < 100000; bytes += 37) {
+    const auto capacity = memory_pool::size_class_bytes(bytes);
+    EXPECT_GE(capacity, bytes);
+    EXPECT_LE(capacity, bytes + bytes / 4);
+  }
+}
+
+TEST_F(MemoryPoolTest, allocate_is_aligned) {
+  for (const std::size_t bytes : {1, 100, 1000, 100000}) {
+    void *ptr = memory_pool::allocate(bytes);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % memory_pool::alignment,
+              0);
+    memory_pool::deallocate(ptr, bytes);
+  }
+}
+
+TEST_F(MemoryPoolTest, reuses_buffer_of_same_size_class) {
+  void *a = memory_pool::allocate(1000);
+  memory_pool::deallocate(a, 1000);
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 1024);
+  void *b = memory_pool::allocate(1010);
+  EXPECT_EQ(a, b);
+  const auto stats = memory_pool::statistics();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.bytes_cached, 0);
+  EXPECT_EQ(stats.high_water_mark, 1024);
+  memory_pool::deallocate(b, 1010);
+}
+
+TEST_F(MemoryPoolTest, does_not_reuse_buffer_of_other_size_class) {
+  void *a = memory_pool::allocate(1000);
+  memory_pool::deallocate(a, 1000);
+  void *b = memory_pool::allocate(2000);
+  EXPECT_EQ(memory_pool::statistics().hits, 0);
+  memory_pool::deallocate(b, 2000);
+}
+
+TEST_F(MemoryPoolTest, trim_releases_cached_bytes) {
+  void *a = memory_pool::allocate(1000);
+  memory_pool::deallocate(a, 1000);
+  memory_pool::trim();
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+  EXPECT_EQ(memory_pool::statistics().high_water_mark, 1024);
+  void *b = memory_pool::allocate(1000);
+  EXPECT_EQ(memory_pool::statistics().hits, 0);
+  memory_pool::deallocate(b, 1000);
+}
+
+TEST_F(MemoryPoolTest, trim_releases_caches_of_other_threads) {
+  std::promise<void> cached;
+  std::promise<void> trimmed;
+  std::thread worker([&]() {
+    void *a = memory_pool::allocate(1000);
+    memory_pool::deallocate(a, 1000);
+    cached.set_value();
+    trimmed.get_future().wait();
+  });
+  cached.get_future().wait();
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 1024);
+  memory_pool::trim();
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+  trimmed.set_value();
+  worker.join();
+}
+
+TEST_F(MemoryPoolTest, thread_exit_releases_cache) {
+  std::thread([]() {
+    void *a = memory_pool::allocate(1000);
+    memory_pool::deallocate(a, 1000);
+  }).join();
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+}
+
+TEST_F(MemoryPoolTest, respects_thread_cache_limit) {
+  const auto limit = memory_pool::thread_cache_limit();
+  const auto count = memory_pool::largest_class_buffers();
+  memory_pool::set_thread_cache_limit(1000);
+  memory_pool::set_largest_class_buffers(0);
+  void *a = memory_pool::allocate(1000);
+  memory_pool::deallocate(a, 1000);
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+  memory_pool::set_thread_cache_limit(limit);
+  memory_pool::set_largest_class_buffers(count);
+}
+
+TEST_F(MemoryPoolTest, thread_cache_limit_scales_with_largest_class) {
+  const auto limit = memory_pool::thread_cache_limit();
+  const auto count = memory_pool::largest_class_buffers();
+  memory_pool::set_thread_cache_limit(1000);
+  memory_pool::set_largest_class_buffers(2);
+  void *a = memory_pool::allocate(10000);
+  void *b = memory_pool::allocate(10000);
+  void *c = memory_pool::allocate(10000);
+  EXPECT_EQ(memory_pool::effective_thread_cache_limit(), 2 * 10240);
+  memory_pool::deallocate(a, 10000);
+  memory_pool::deallocate(b, 10000);
+  memory_pool::deallocate(c, 10000);
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 2 * 10240);
+  memory_pool::trim();
+  EXPECT_EQ(memory_pool::effective_thread_cache_limit(), 1000);
+  memory_pool::set_thread_cache_limit(limit);
+  memory_pool::set_largest_class_buffers(count);
+}
+
+TEST_F(MemoryPoolTest, caches_buffers_larger_than_thread_cache_limit) {
+  const std::size_t bytes = memory_pool::thread_cache_limit() + 1;
+  void *a = memory_pool::allocate(bytes);
+  memory_pool::deallocate(a, bytes);
+  void *b = memory_pool::allocate(bytes);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(memory_pool::statistics().hits, 1);
+  memory_pool::deallocate(b, bytes);
+}
+
+TEST_F(MemoryPoolTest, disable_trims) {
+  void *a = memory_pool::allocate(1000);
+  memory_pool::deallocate(a, 1000);
+  memory_pool::set_enabled(false);
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+}
+
+TEST_F(MemoryPoolTest, element_array_uses_pool) {
+  const double *data = nullptr;
+  {
+    element_array<double> x(1000, init_for_overwrite);
+    data = x.data();
+  }
+  element_array<double> y(1000, 1.5);
+  EXPECT_EQ(y.data(), data);
+  EXPECT_EQ(y.data()[999], 1.5);
+  EXPECT_EQ(memory_pool::statistics().hits, 1);
+}
+
+TEST_F(MemoryPoolTest, element_array_non_trivial_type) {
+  element_array<std::string> x(3, std::string(100, 'a'));
+  element_array<std::string> y(x);
+  x = element_array<std::string>(2, init_for_overwrite);
+  EXPECT_EQ(x.data()[1], "");
+  EXPECT_EQ(y.data()[2], std::string(100, 'a'));
+}
+
+TEST_F(MemoryPoolTest, element_array_outlives_enabled_pool) {
+  element_array<double> x(1000);
+  memory_pool::set_enabled(false);
+  x.reset();
+  element_array<double> y(1000);
+  memory_pool::set_enabled(true);
+  y.reset();
+  EXPECT_EQ(memory_pool::statistics().bytes_cached, 0);
+}
@@ -180,8 +180,56 @@ TEST_F(MultiIndexTest, 6d) {
   check(i, {0, 1, 2, 3, 4, 5, 6, 7});
 }
 
+namespace {
+/// Flat indices for iterating `iter_dims` in order, computed without
+/// MultiIndex.
+std::vector<scipp::index> naive_indices(const Dimensions &iter_dims,
+                                        const Strides &strides) {
+  std::vector<scipp::index> indices;
+  for (scipp::index i = 0; i < iter_dims.volume(); ++i) {
+    scipp::index remainder = i;
+    scipp::index flat = 0;
+    for (scipp::index d = iter_dims.ndim() - 1; d >= 0; --d) {
+      flat += remainder % iter_dims.size(d) * strides[d];
+      remainder /= iter_dims.size(d);
+    }
+    indices.push_back(flat);
+  }
+  return indices;
+}
+
+/// Dimensions in reverse order, i.e., all transposed with respect to `dims`.
+Dimensions reversed(const Dimensions &dims) {
+  Dimensions out;
+  for (const auto &dim : dims.labels())
+    out.add(dim, dims[dim]);
+  return out;
+}
+} // namespace
+
+TEST_F(MultiIndexTest, more_dims_than_stack_capacity) {
+  Dimensions dims({Dim("1"), Dim("2"), Dim("3"), Dim("4"), Dim("5"), Dim("6"),
+                   Dim("7"), Dim("8")},
+                  {2, 3, 2, 2, 3, 2, 2, 2});
+  // Second operand transposed, no dims can be flattened.
+  const auto strides = make_strides(dims, reversed(dims));
+  check(MultiIndex(dims, Strides(dims), strides),
+        naive_indices(dims, Strides(dims)), naive_indices(dims, strides));
+}
+
+TEST_F(MultiIndexTest, length_1_dims_are_dropped) {
+  Dimensions dims({Dim("1"), Dim("2"), Dim("3"), Dim("4"), Dim("5"), Dim("6"),
+                   Dim("7"), Dim("8")},
+                  {2, 1, 3, 1, 1, 2, 1, 2});
+  const auto strides = make_strides(dims, reversed(dims));
+  check(MultiIndex(dims, Strides(dims), strides),
+        naive_indices(dims, Strides(dims)), naive_indices(dims, strides));
+}
+
 TEST_F(MultiIndexTest, 2d_transpose) {
-  check(MultiIndex<1>(yx, make_strides(yx, xy)), {0, 3, 1, 4, 2, 5});
+  // Dims are reordered such that the first operand is iterated in memory
+  // order.
+  check(MultiIndex<1>(yx, make_strides(yx, xy)), {0, 1, 2, 3, 4, 5});
 }
 
 TEST_F(MultiIndexTest, slice_and_broadcast) {
@@ -196,11 +244,42 @@ TEST_F(MultiIndexTest, multiple_data_indices) {
   check(MultiIndex(xy, make_strides(xy, x), make_strides(xy, y)),
         {0, 0, 0, 1, 1, 1}, {0, 1, 2, 0, 1, 2});
   check(MultiIndex(xy, make_strides(xy, yx), make_strides(xy, xy)),
-        {0, 2, 4, 1, 3, 5}, {0, 1, 2, 3, 4, 5});
+        {0, 1, 2, 3, 4, 5}, {0, 3, 1, 4, 2, 5});
   check(MultiIndex(yx, make_strides(yx, yx), make_strides(yx, xy)),
         {0, 1, 2, 3, 4, 5}, {0, 3, 1, 4, 2, 5});
 }
 
+TEST_F(MultiIndexTest, contiguous_dims_are_merged) {
+  EXPECT_EQ(MultiIndex(xyz, Strides(xyz)).begin().inner_distance_to_end(), 24);
+  EXPECT_EQ(MultiIndex(xyz, Strides(xyz), make_strides(xyz, xy))
+                .begin()
+                .inner_distance_to_end(),
+            4);
+  // Broadcast in both outer dims.
+  EXPECT_EQ(MultiIndex(xyz, Strides(xyz), make_strides(xyz, z))
+                .begin()
+                .inner_distance_to_end(),
+            4);
+  // Slice of a contiguous array.
+  EXPECT_EQ(
+      MultiIndex(xz, make_strides(xz, xyz)).begin().inner_distance_to_end(),
+      4);
+}
+
+TEST_F(MultiIndexTest, transposed_first_operand_is_merged_after_reorder) {
+  const Dimensions zyx{{Dim::Z, Dim::Y, Dim::X}, {4, 3, 2}};
+  const auto index =
+      MultiIndex(zyx, make_strides(zyx, xyz), make_strides(zyx, xyz));
+  EXPECT_EQ(index.begin().inner_distance_to_end(), 24);
+  EXPECT_EQ(index.inner_strides()[0], 1);
+  EXPECT_EQ(index.inner_strides()[1], 1);
+}
+
+TEST_F(MultiIndexTest, order_preserved_if_first_operand_has_stride_zero) {
+  check(MultiIndex(yx, make_strides(yx, y), make_strides(yx, xy)),
+        {0, 0, 1, 1, 2, 2}, {0, 3, 1, 4, 2, 5});
+}
+
 TEST_F(MultiIndexTest, advance_multiple_data_indices) {
   MultiIndex index(yx, make_strides(yx, x), make_strides(yx, y));
   index.set_index(1);
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/numa.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class NumaTest : public ::testing::TestWithParam<numa::Policy> {
+protected:
+  NumaTest() { numa::set_policy(GetParam()); }
+  ~NumaTest() override { numa::set_policy(numa::Policy::Default); }
+};
+
+INSTANTIATE_TEST_SUITE_P(Policies, NumaTest,
+                         ::testing::Values(numa::Policy::Default,
+                                           numa::Policy::FirstTouch,
+                                           numa::Policy::Interleave));
+
+TEST(NumaPolicyTest, default_policy) {
+  EXPECT_EQ(numa::policy(), numa::Policy::Default);
+}
+
+TEST(NumaPolicyTest, node_count_positive) { EXPECT_GE(numa::node_count(), 1); }
+
+TEST_P(NumaTest, set_policy) { EXPECT_EQ(numa::policy(), GetParam()); }
+
+TEST_P(NumaTest, place_small_and_null_is_noop) {
+  numa::place(nullptr, 1000000, sizeof(double));
+  double x = 1.5;
+  numa::place(&x, 1, sizeof(double));
+  EXPECT_EQ(x, 1.5);
+}
+
+TEST_P(NumaTest, large_array_for_overwrite) {
+  const scipp::index size = 3 * numa::min_place_bytes / sizeof(double) + 7;
+  element_array<double> array(size, init_for_overwrite);
+  std::fill(array.begin(), array.end(), 2.0);
+  EXPECT_TRUE(std::all_of(array.begin(), array.end(),
+                          [](const double x) { return x == 2.0; }));
+}
+
+TEST_P(NumaTest, large_array_filled) {
+  const scipp::index size = numa::min_place_bytes / sizeof(int32_t) + 3;
+  const element_array<int32_t> array(size, 7);
+  EXPECT_TRUE(std::all_of(array.begin(), array.end(),
+                          [](const int32_t x) { return x == 7; }));
+}
+
+TEST_P(NumaTest, resize_for_overwrite) {
+  element_array<float> array(10, 1.0f);
+  array.resize(numa::min_place_bytes, init_for_overwrite);
+  std::fill(array.begin(), array.end(), 3.0f);
+  EXPECT_EQ(array.size(), numa::min_place_bytes);
+  EXPECT_EQ(array.data()[0], 3.0f);
+  EXPECT_EQ(array.data()[array.size() - 1], 3.0f);
+}
+
+TEST_P(NumaTest, parallel_for_covers_range) {
+  const scipp::index size = 100003;
+  std::vector<int32_t> count(size, 0);
+  numa::parallel_for(size, [&](const auto &range) {
+    for (auto i = range.begin(); i < range.end(); ++i)
+      ++count[i];
+  });
+  EXPECT_TRUE(std::all_of(count.begin(), count.end(),
+                          [](const int32_t x) { return x == 1; }));
+}
+
+TEST_P(NumaTest, first_touch_active) {
+  EXPECT_EQ(numa::first_touch_active(),
+            GetParam() == numa::Policy::FirstTouch && numa::node_count() > 1);
+}
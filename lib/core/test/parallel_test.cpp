@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "scipp/core/parallel.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(ParallelTest, max_concurrency_is_positive) {
+  EXPECT_GE(parallel::max_concurrency(), 1);
+}
+
+TEST(ParallelTest, thread_limit) {
+  const auto unlimited = parallel::max_concurrency();
+  {
+    const parallel::ThreadLimit limit(1);
+    EXPECT_EQ(parallel::max_concurrency(), 1);
+    {
+      const parallel::ThreadLimit nested(2);
+      EXPECT_EQ(parallel::max_concurrency(), 1);
+    }
+  }
+  EXPECT_EQ(parallel::max_concurrency(), unlimited);
+}
+
+TEST(ParallelTest, thread_limit_does_not_affect_other_threads) {
+  const auto unlimited = parallel::max_concurrency();
+  const parallel::ThreadLimit limit(1);
+  scipp::index other = 0;
+  std::thread([&]() { other = parallel::max_concurrency(); }).join();
+  EXPECT_EQ(other, unlimited);
+}
+
+TEST(ParallelTest, thread_limit_applies_to_parallel_for) {
+  const parallel::ThreadLimit limit(1);
+  std::atomic<scipp::index> max_threads{0};
+  parallel::parallel_for(parallel::blocked_range(0, 1000, 1),
+                         [&](const auto &) {
+                           if (parallel::max_concurrency() > max_threads)
+                             max_threads = parallel::max_concurrency();
+                         });
+  EXPECT_EQ(max_threads, 1);
+}
+
+TEST(ParallelTest, blocked_range_covers_range) {
+  for (const scipp::index size : {0, 1, 7, 1000, 123457}) {
+    std::atomic<scipp::index> count{0};
+    parallel::parallel_for(parallel::blocked_range(0, size),
+                           [&](const auto &range) {
+                             count += range.end() - range.begin();
+                           });
+    EXPECT_EQ(count, size);
+  }
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/partial_reduce.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(PartialReduceTest, chunk_count_is_1_for_small_input) {
+  EXPECT_EQ(partial_reduce::chunk_count(0, 10), 1);
+  EXPECT_EQ(partial_reduce::chunk_count(1000, 10), 1);
+  EXPECT_EQ(partial_reduce::chunk_count(1000000, 1000000), 1);
+}
+
+TEST(PartialReduceTest, chunk_count_is_at_least_1_without_outputs) {
+  EXPECT_GE(partial_reduce::chunk_count(1000000, 0), 1);
+}
+
+TEST(PartialReduceTest, chunk_count_can_exceed_core_count_of_large_nodes) {
+  EXPECT_GE(partial_reduce::chunk_count(1000000000, 1000), 512);
+}
+
+TEST(PartialReduceTest, chunk_count_does_not_depend_on_thread_limit) {
+  const auto expected = partial_reduce::chunk_count(100000000, 10);
+  EXPECT_EQ(expected, partial_reduce::max_chunks);
+  const parallel::ThreadLimit limit(1);
+  EXPECT_EQ(partial_reduce::chunk_count(100000000, 10), expected);
+}
+
+TEST(PartialReduceTest, partials_are_zeroed_and_aligned) {
+  const partial_reduce::Partials<double> partials(3, 5);
+  for (scipp::index chunk = 0; chunk < 3; ++chunk) {
+    EXPECT_EQ(partials[chunk].size(), 5);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(partials[chunk].data()) %
+                  cache::line_size,
+              0);
+    for (const auto x : partials[chunk])
+      EXPECT_EQ(x, 0.0);
+  }
+}
+
+TEST(PartialReduceTest, partials_without_chunks) {
+  const partial_reduce::Partials<bool> partials(0, 5);
+  SUCCEED();
+}
+
+TEST(PartialReduceTest, run) {
+  std::vector<int64_t> input(100000);
+  std::iota(input.begin(), input.end(), 0);
+  const scipp::index nout = 7;
+  const scipp::index nchunk = 3;
+  const partial_reduce::Partials<int64_t> partials(nchunk, nout);
+  std::vector<int64_t> output(nout, 0);
+  partial_reduce::run(
+      nchunk, scipp::size(input), nout,
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        for (auto i = begin; i != end; ++i)
+          partials[chunk][i % nout] += input[i];
+      },
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        for (auto i = begin; i != end; ++i)
+          output[i] += partials[chunk][i];
+      });
+  std::vector<int64_t> expected(nout, 0);
+  for (const auto x : input)
+    expected[x % nout] += x;
+  EXPECT_EQ(output, expected);
+}
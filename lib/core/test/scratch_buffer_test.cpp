@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "scipp/core/scratch_buffer.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+// Distinct types so tests do not share thread-local slots.
+struct Tag1 {};
+struct Tag2 {};
+struct Tag3 {};
+struct Tag4 {};
+} // namespace
+
+TEST(ScratchBufferTest, capacity_is_kept_across_leases) {
+  using Buffer = std::tuple<std::vector<double>, Tag1>;
+  const double *data = nullptr;
+  {
+    scratch::Lease<Buffer> lease;
+    std::get<0>(*lease).resize(1000);
+    data = std::get<0>(*lease).data();
+    std::get<0>(*lease).clear();
+  }
+  scratch::Lease<Buffer> lease;
+  EXPECT_GE(std::get<0>(*lease).capacity(), 1000);
+  EXPECT_EQ(std::get<0>(*lease).data(), data);
+}
+
+TEST(ScratchBufferTest, nested_lease_uses_separate_object) {
+  using Buffer = std::tuple<std::vector<double>, Tag2>;
+  scratch::Lease<Buffer> outer;
+  scratch::Lease<Buffer> inner;
+  EXPECT_NE(&*outer, &*inner);
+}
+
+TEST(ScratchBufferTest, allocated_bytes) {
+  using Buffer = std::tuple<std::vector<std::vector<double>>, Tag3>;
+  const auto before = scratch::allocated_bytes();
+  {
+    scratch::Lease<Buffer> lease;
+    auto &chunks = std::get<0>(*lease);
+    chunks.resize(2);
+    chunks[0].reserve(100);
+    chunks[1].reserve(200);
+  }
+  EXPECT_GE(scratch::allocated_bytes() - before,
+            static_cast<scipp::index>(2 * sizeof(std::vector<double>) +
+                                      300 * sizeof(double)));
+}
+
+TEST(ScratchBufferTest, retain_limit) {
+  using Buffer = std::tuple<std::vector<double>, Tag4>;
+  const auto limit = scratch::retain_limit();
+  scratch::set_retain_limit(1000);
+  const auto before = scratch::allocated_bytes();
+  {
+    scratch::Lease<Buffer> lease;
+    std::get<0>(*lease).resize(1000);
+  }
+  EXPECT_EQ(scratch::allocated_bytes(), before);
+  scratch::Lease<Buffer> lease;
+  EXPECT_EQ(std::get<0>(*lease).capacity(), 0);
+  scratch::set_retain_limit(limit);
+}
+
+TEST(ScratchBufferTest, thread_exit_releases_buffer) {
+  const auto before = scratch::allocated_bytes();
+  std::thread([]() {
+    scratch::Lease<std::vector<float>> lease;
+    lease->resize(1000);
+  }).join();
+  EXPECT_EQ(scratch::allocated_bytes(), before);
+}
@@ -2,6 +2,8 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "test_macros.h"
 
 #include "scipp/core/view_index.h"
@@ -212,3 +214,60 @@ TEST(ViewIndexTest, empty2D) {
   EXPECT_EQ(idx.get(), 0);
   EXPECT_EQ(idx.index(), 0);
 }
+
+TEST(ViewIndexTest, more_dims_than_stack_capacity) {
+  const Dimensions dims({Dim("1"), Dim("2"), Dim("3"), Dim("4"), Dim("5"),
+                         Dim("6"), Dim("7"), Dim("8")},
+                        {2, 3, 2, 2, 3, 2, 2, 2});
+  // Strides of the transpose, such that no dims can be flattened.
+  Strides strides;
+  strides.resize(dims.ndim());
+  scipp::index stride = 1;
+  for (scipp::index d = 0; d < dims.ndim(); ++d) {
+    strides[d] = stride;
+    stride *= dims.size(d);
+  }
+  ViewIndex it(dims, strides);
+  std::vector<scipp::index> coord(dims.ndim(), 0);
+  for (scipp::index i = 0; i < dims.volume(); ++i) {
+    scipp::index expected = 0;
+    for (scipp::index d = 0; d < dims.ndim(); ++d)
+      expected += coord[d] * strides[d];
+    ASSERT_EQ(it.get(), expected);
+    ASSERT_EQ(it.index(), i);
+    it.increment();
+    for (scipp::index d = dims.ndim() - 1; d >= 0; --d) {
+      if (++coord[d] < dims.size(d))
+        break;
+      coord[d] = 0;
+    }
+  }
+  ViewIndex end(dims, strides);
+  end.set_index(dims.volume());
+  EXPECT_EQ(it, end);
+  it.set_index(17);
+  end.set_index(0);
+  for (scipp::index i = 0; i < 17; ++i)
+    end.increment();
+  EXPECT_EQ(it.get(), end.get());
+}
+
+TEST(ViewIndexTest, more_dims_than_stack_capacity_set_index) {
+  // Dims 7-9 are contiguous and flattened, 2-6 are transposed, and 0-1 are
+  // flattened into a single dim beyond the stack capacity.
+  const Dimensions dims({Dim("0"), Dim("1"), Dim("2"), Dim("3"), Dim("4"),
+                         Dim("5"), Dim("6"), Dim("7"), Dim("8"), Dim("9")},
+                        {2, 3, 2, 2, 3, 2, 2, 2, 3, 2});
+  const Strides strides{1728, 576, 12, 24, 48, 144, 288, 6, 2, 1};
+  ViewIndex it(dims, strides);
+  ViewIndex other(dims, strides);
+  for (scipp::index i = 0; i < dims.volume(); ++i) {
+    other.set_index(i);
+    ASSERT_EQ(it.get(), other.get());
+    it.increment();
+  }
+  other.set_index(dims.volume());
+  EXPECT_EQ(it, other);
+  other.set_index(dims.volume() - 1);
+  EXPECT_EQ(other.get(), 3455);
+}
@@ -2,6 +2,11 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Jan-Lukas Wynen
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+
 #include "scipp/core/view_index.h"
 
 #include "scipp/core/except.h"
@@ -10,6 +15,7 @@ namespace scipp::core {
 
 ViewIndex::ViewIndex(const Dimensions &target_dimensions,
                      const Strides &strides) {
+  std::vector<OuterDims::Dim> outer_dims;
   scipp::index rewind = 0;
   scipp::index dim_write = 0;
   for (scipp::index dim_read = target_dimensions.ndim() - 1; dim_read >= 0;
@@ -19,19 +25,32 @@ ViewIndex::ViewIndex(const Dimensions &target_dimensions,
     const auto size = target_dimensions.size(dim_read);
     rewind = size * stride;
     if (delta != 0 || stride == 0) {
-      m_shape[dim_write] = size;
-      m_delta[dim_write] = delta;
-      m_strides[dim_write] = stride;
+      if (dim_write < NDIM_OP_MAX) {
+        m_shape[dim_write] = size;
+        m_delta[dim_write] = delta;
+        m_strides[dim_write] = stride;
+      } else {
+        outer_dims.push_back({size, stride});
+      }
       ++dim_write;
     } else {
       // The memory for this dimension is contiguous with the previous dim,
       // so we flatten them into one dimension.
       // This cannot happen in the innermost dim because if stride != 0,
       // delta != 0 because rewind == 0.
-      m_shape[dim_write - 1] *= size;
+      (dim_write > NDIM_OP_MAX ? outer_dims.back().size
+                               : m_shape[dim_write - 1]) *= size;
     }
   }
-  m_ndim = dim_write;
+  m_ndim = static_cast<int32_t>(std::min(dim_write, scipp::index{NDIM_OP_MAX}));
+  if (!outer_dims.empty()) {
+    auto outer = std::make_shared<OuterDims>();
+    outer->dims = std::move(outer_dims);
+    outer->inner_volume =
+        std::accumulate(m_shape.begin(), m_shape.end(), scipp::index{1},
+                        std::multiplies<>());
+    m_outer = std::move(outer);
+  }
 }
 
 } // namespace scipp::core
@@ -3,12 +3,14 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <iterator>
 #include <limits>
 
 #include "scipp/core/bucket.h"
 #include "scipp/core/element/event_operations.h"
 #include "scipp/core/element/histogram.h"
 #include "scipp/core/except.h"
+#include "scipp/core/partial_reduce.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
@@ -224,14 +226,13 @@ Variable lookup_previous(const DataArray &function, const Variable &x, Dim dim,
 Variable pretend_bins_for_threading(const DataArray &da, Dim bin_dim) {
   const auto dim = da.dims().inner();
   const auto size = std::max(scipp::index(1), da.dims()[dim]);
-  const auto nthread = size > 8000000   ? 24
-                       : size > 4000000 ? 16
-                       : size > 1000000 ? 8
-                       : size > 200000  ? 4
-                       : size > 100000  ? 2
-                                        : 1;
-
-  const auto stride = std::max(scipp::index(1), size / nthread);
+  // Below this many rows per chunk the overhead of threading dominates. The
+  // chunk count depends only on the size, not on the number of threads.
+  constexpr scipp::index min_rows_per_chunk = 100000;
+  const auto nchunk = std::clamp(size / min_rows_per_chunk, scipp::index(1),
+                                 core::partial_reduce::max_chunks);
+
+  const auto stride = std::max(scipp::index(1), size / nchunk);
   auto begin = bin_detail::make_range(0, size, stride, bin_dim);
   auto end = begin + stride * sc_units::none;
   end.values<scipp::index>().as_span().back() = da.dims()[dim];
@@ -267,6 +268,110 @@ template <class T> auto combine(const Variable &var0, const Variable &var1) {
   return make_bins_no_validate(zip(begin, end), dim, std::move(buffer));
 }
 
+/// Return true if `var` does not share its data with other objects.
+bool is_exclusive(const Variable &var) {
+  return !var.is_slice() && var.data_handle().use_count() == 1;
+}
+
+bool is_exclusive(const DataArray &da) {
+  const auto exclusive = [](const auto &dict) {
+    return std::all_of(dict.values_begin(), dict.values_end(),
+                       [](const Variable &var) { return is_exclusive(var); });
+  };
+  return is_exclusive(da.data()) && exclusive(da.coords()) &&
+         exclusive(da.masks());
+}
+
+/// Datasets create temporary references to their items when iterated, so
+/// sharing cannot be detected. Always treat them as shared.
+bool is_exclusive(const Dataset &) { return false; }
+
+/// Append bins of `var1` to those of `var0` using spare capacity in the buffer.
+///
+/// The capacity of a bin extends to the begin of the next bin, or to the end of
+/// the buffer for the last bin. Returns false without modifying `var0` if the
+/// bins are not ordered in the buffer or if any bin lacks capacity. Also
+/// returns false if `var0` is a slice or if its buffer is shared, e.g., with
+/// the output of binned `take`, since the spare capacity of `var0` may hold
+/// events of other binned variables.
+template <class T>
+bool append_to_capacity(Variable &var0, const Variable &var1) {
+  if (var0.is_slice() || !is_exclusive(var0.bin_buffer<T>()))
+    return false;
+  auto [indices0, dim, buffer0] = var0.constituents<T>();
+  const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
+  static_cast<void>(dim1);
+  const auto [begin1, end1] = unzip(indices1);
+  const auto sizes1 = (end1 - begin1).broadcast(var0.dims());
+  const auto ranges = indices0.template values<scipp::index_pair>();
+  const auto added = sizes1.template values<scipp::index>();
+  const scipp::index buffer_size = buffer0.dims()[dim];
+  auto size = added.begin();
+  for (auto range = ranges.begin(); range != ranges.end(); ++range, ++size) {
+    const auto next = std::next(range);
+    const auto capacity_end = next == ranges.end() ? buffer_size : next->first;
+    if (range->second + *size > capacity_end)
+      return false;
+  }
+  const auto end0 = unzip(indices0).second;
+  copy_slices(buffer1, buffer0, dim, indices1, zip(end0, end0 + sizes1));
+  size = added.begin();
+  for (auto &range : ranges)
+    range.second += *size++;
+  return true;
+}
+
+/// Replace indices and buffer of `var` in-place by those of `replacement`.
+///
+/// In contrast to Variable::setDataHandle, all variables sharing the model of
+/// `var`, e.g., the data of a data array, see the change.
+void replace_model(Variable &var, const Variable &replacement) {
+  if (var.is_slice())
+    throw except::DimensionError(
+        "Cannot replace the bins of a slice of binned data in-place.");
+  var.data().assign(replacement.data());
+}
+
+/// Append bins of `var1` to those of `var0`, reserving spare capacity.
+///
+/// Each bin is given twice its new size plus the mean bin size as capacity, so
+/// that subsequent calls to `append_to_capacity` usually succeed and the buffer
+/// is reallocated only a logarithmic number of times. Like
+/// `append_to_capacity`, this modifies the model shared by all aliases of
+/// `var0`.
+template <class T>
+void append_with_capacity(Variable &var0, const Variable &var1) {
+  const auto &[indices0, dim, buffer0] = var0.constituents<T>();
+  const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
+  static_cast<void>(dim1);
+  const auto [begin0, end0] = unzip(indices0);
+  const auto [begin1, end1] = unzip(indices1);
+  const auto sizes0 = end0 - begin0;
+  const auto sizes = sizes0 + (end1 - begin1);
+  const auto nbin = std::max(scipp::index{1}, sizes.dims().volume());
+  const auto total = sum(sizes).template value<scipp::index>();
+  const auto mean_size = (total + nbin - 1) / nbin;
+  const auto capacity = sizes + sizes + mean_size * sc_units::none;
+  const auto capacity_end = cumsum(capacity);
+  const auto begin = capacity_end - capacity;
+  const auto total_capacity =
+      capacity_end.dims().volume() > 0
+          ? capacity_end.template values<scipp::index>().as_span().back()
+          : 0;
+  auto buffer = resize_default_init(buffer0, dim, total_capacity);
+  copy_slices(buffer0, buffer, dim, indices0, zip(begin, begin + sizes0));
+  copy_slices(buffer1, buffer, dim, indices1,
+              zip(begin + sizes0, begin + sizes));
+  replace_model(var0, make_bins_no_validate(zip(begin, begin + sizes), dim,
+                                            std::move(buffer)));
+}
+
+template <class T> void extend_impl(Variable &var0, const Variable &var1) {
+  scipp::expect::includes(var0.dims(), var1.dims());
+  if (!append_to_capacity<T>(var0, var1))
+    append_with_capacity<T>(var0, var1);
+}
+
 template <class T>
 auto concatenate_impl(const Variable &var0, const Variable &var1) {
   return combine<T>(var0, var1);
@@ -325,6 +430,42 @@ void append(DataArray &a, const DataArray &b) {
   a.setData(data);
 }
 
+/// Append bins of `var1` to those of `var0` in-place, with amortized cost.
+///
+/// In contrast to `append`, spare capacity is kept in the buffer, so appending
+/// to each bin usually costs only the number of appended events instead of the
+/// total buffer size. This is intended for accumulating a stream of events.
+/// The unused parts of the buffer between bins are overwritten. If the buffer
+/// is shared with other binned variables it is reallocated instead. Either
+/// way, the bins are modified in-place, i.e., all variables sharing the bins of
+/// `var0` see the appended events. Use `compact` to release the spare
+/// capacity.
+void extend(Variable &var0, const Variable &var1) {
+  if (var0.dtype() == dtype<bucket<Variable>>)
+    extend_impl<Variable>(var0, var1);
+  else if (var0.dtype() == dtype<bucket<DataArray>>)
+    extend_impl<DataArray>(var0, var1);
+  else
+    extend_impl<Dataset>(var0, var1);
+}
+
+void extend(DataArray &a, const DataArray &b) {
+  expect::coords_are_superset(a, b, "bins.extend");
+  union_or_in_place(a.masks(), b.masks());
+  auto data = a.data();
+  extend(data, b.data());
+  a.setData(data);
+}
+
+/// Release spare capacity of the buffer of binned data in-place.
+void compact(Variable &var) { replace_model(var, copy(var)); }
+
+void compact(DataArray &a) {
+  auto data = a.data();
+  compact(data);
+  a.setData(data);
+}
+
 Variable histogram(const Variable &data, const Variable &binEdges) {
   using namespace scipp::core;
   auto hist_dim = binEdges.dims().inner();
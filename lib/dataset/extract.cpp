@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #include <numeric>
 
+#include "scipp/variable/take.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "scipp/dataset/bins.h"
@@ -11,6 +12,8 @@
 #include "scipp/dataset/extract.h"
 #include "scipp/dataset/util.h"
 
+#include "dataset_operations_common.h"
+
 namespace scipp {
 
 namespace {
@@ -83,6 +86,53 @@ T extract_ranges(const Variable &indices, const T &data, const Dim dim) {
   return transform_data(out, dense_or_copy_bin_elements, no_edges);
 }
 
+namespace {
+/// Gather slices of `var`, or copy `var` if it does not depend on `dim`.
+///
+/// The result never shares data with `var`. For binned data only the events
+/// of the selected bins are copied.
+Variable take_or_copy(const Variable &var, const Variable &indices,
+                      const Dim dim) {
+  if (!var.dims().contains(dim))
+    return copy(var);
+  auto taken = variable::take(var, indices, dim);
+  return is_bins(taken) ? copy(taken) : taken;
+}
+} // namespace
+
+/// Return the slices of `data` at the given positions along `dim`.
+///
+/// Data, coords, and masks are gathered in a single pass each. Bin-edges along
+/// `dim` are dropped.
+template <class T>
+T extract_indices(const Variable &indices, const T &data, const Dim dim) {
+  const auto take = [&](const Variable &var) {
+    return take_or_copy(var, indices, dim);
+  };
+  if constexpr (std::is_same_v<T, Variable>) {
+    return take(data);
+  } else if constexpr (std::is_same_v<T, DataArray>) {
+    auto out = dataset::transform(strip_edges_along(data, dim), take);
+    out.setName(data.name());
+    return out;
+  } else {
+    using dataset::Coords;
+    using dataset::Masks;
+    using dataset::transform_map;
+    const auto stripped = strip_edges_along(data, dim);
+    Dataset out{{},
+                Coords(stripped.coords().sizes(),
+                       transform_map<Coords::holder_type>(stripped.coords(),
+                                                          take))};
+    for (const auto &item : stripped)
+      out.setData(item.name(),
+                  DataArray(take(item.data()), {},
+                            transform_map<Masks::holder_type>(item.masks(),
+                                                              take)));
+    return out;
+  }
+}
+
 namespace {
 template <class T> T extract_impl(const T &obj, const Variable &condition) {
   if (condition.dtype() != dtype<bool>)
@@ -98,21 +148,8 @@ template <class T> T extract_impl(const T &obj, const Variable &condition) {
         "Condition dimensions " + to_string(condition.dims()) +
         " must be be included in the dimensions of the sliced object " +
         to_string(obj.dims()) + '.');
-
-  auto values = condition.values<bool>().as_span();
-  std::vector<scipp::index_pair> indices;
-  for (scipp::index i = 0; i < scipp::size(values); ++i) {
-    if (i > 0 && values[i - 1] == values[i])
-      continue;    // not an edge
-    if (values[i]) // rising edge
-      indices.emplace_back(i, scipp::size(values));
-    else if (i != 0) // falling edge
-      indices.back().second = i;
-  }
-  return extract_ranges(makeVariable<scipp::index_pair>(Dims{condition.dim()},
-                                                        Shape{indices.size()},
-                                                        Values(indices)),
-                        obj, condition.dim());
+  return extract_indices(variable::flatnonzero(condition), obj,
+                         condition.dim());
 }
 } // namespace
 
@@ -137,5 +174,14 @@ template SCIPP_DATASET_EXPORT DataArray extract_ranges(const Variable &,
 template SCIPP_DATASET_EXPORT Dataset extract_ranges(const Variable &,
                                                      const Dataset &,
                                                      const Dim);
+template SCIPP_DATASET_EXPORT Variable extract_indices(const Variable &,
+                                                       const Variable &,
+                                                       const Dim);
+template SCIPP_DATASET_EXPORT DataArray extract_indices(const Variable &,
+                                                        const DataArray &,
+                                                        const Dim);
+template SCIPP_DATASET_EXPORT Dataset extract_indices(const Variable &,
+                                                      const Dataset &,
+                                                      const Dim);
 
 } // namespace scipp
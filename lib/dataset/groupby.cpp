@@ -3,15 +3,21 @@
 /// @file
 /// @author Simon Heybrock
 #include <numeric>
+#include <optional>
+#include <span>
 
 #include "scipp/core/bucket.h"
+#include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
 #include "scipp/core/histogram.h"
 #include "scipp/core/parallel.h"
+#include "scipp/core/partial_reduce.h"
 #include "scipp/core/tag_util.h"
+#include "scipp/core/value_and_variance.h"
 
 #include "scipp/variable/accumulate.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/operations.h"
 #include "scipp/variable/util.h"
@@ -68,13 +74,268 @@ T GroupBy<T>::makeReductionOutput(const Dim reductionDim,
 }
 
 namespace {
+/// A reduction operation for groupby.
+///
+/// `into` reduces slices of the data into slices of the output and supports
+/// all inputs. `op` is the corresponding element operation used for reducing
+/// row by row.
+template <class Op> struct Reduction {
+  void (*into)(Variable &, const Variable &);
+  Op op;
+  /// Accumulate float32 in float64, as variable::sum_into does.
+  bool accumulate_float_as_double{false};
+};
+template <class Op>
+Reduction(void (*)(Variable &, const Variable &), Op, bool = false)
+    -> Reduction<Op>;
+
+/// Below this average number of rows per contiguous run of equal keys the
+/// overhead of handling slices dominates, so groups are reduced row by row.
+constexpr scipp::index min_rows_per_slice = 256;
+
+template <class T, class Tuple> struct tuple_contains;
+template <class T, class... Ts>
+struct tuple_contains<T, std::tuple<Ts...>>
+    : std::disjunction<std::is_same<T, Ts>...> {};
+
+/// True if `Op` supports accumulating `In` into `Acc`.
+template <class Op, class Acc, class In>
+constexpr bool supports =
+    (std::is_same_v<Acc, In> &&
+     tuple_contains<Acc, typename Op::types>::value) ||
+    tuple_contains<std::tuple<Acc, In>, typename Op::types>::value;
+
+/// Only sums are supported for data with variances, other reductions fall back
+/// to reducing slice by slice.
+template <class Op>
+constexpr bool supports_variances =
+    std::is_same_v<Op, std::decay_t<decltype(core::element::add_equals)>>;
+
+/// Return the index of the group of each row, -1 for rows not in any group.
+template <class Groups>
+std::vector<scipp::index> group_of_rows(const Groups &groups,
+                                        const scipp::index nrow) {
+  std::vector<scipp::index> rows(nrow, -1);
+  for (scipp::index group = 0; group < scipp::size(groups); ++group)
+    for (const auto &slice : groups[group])
+      std::fill(rows.begin() + slice.begin(), rows.begin() + slice.end(),
+                group);
+  return rows;
+}
+
+template <bool Variances, class Op, class Acc, class In>
+void apply_op(Op &op, Acc *vals, Acc *vars, const scipp::index i,
+              const In *in_vals, const In *in_vars, const scipp::index j) {
+  if constexpr (Variances) {
+    ValueAndVariance<Acc> x{vals[i], vars[i]};
+    op(x, ValueAndVariance<Acc>{static_cast<Acc>(in_vals[j]),
+                                static_cast<Acc>(in_vars[j])});
+    vals[i] = x.value;
+    vars[i] = x.variance;
+  } else {
+    op(vals[i], in_vals[j]);
+  }
+}
+
+/// Reduce `data` into `accum` row by row, with rows given by the slices of
+/// each group in `groups`.
+///
+/// Both `data` and `accum` have the default memory layout, so rows of all
+/// other dims are contiguous. If there are many rows per group, ranges of rows
+/// are reduced from multiple threads, see core::partial_reduce. Otherwise
+/// ranges of groups are reduced from multiple threads.
+template <class Acc, class In, bool Variances, class Op, class Groups>
+void reduce_rows(Op op, Variable &accum, const Variable &data, const Dim dim,
+                 const Groups &groups) {
+  const auto &dims = data.dims();
+  const auto axis = dims.index(dim);
+  scipp::index n_outer = 1;
+  scipp::index n_inner = 1;
+  for (scipp::index i = 0; i < axis; ++i)
+    n_outer *= dims.size(i);
+  for (scipp::index i = axis + 1; i < dims.ndim(); ++i)
+    n_inner *= dims.size(i);
+  const auto nrow = dims.size(axis);
+  const auto ngroup = accum.dims().size(axis);
+  const auto *in_vals = data.values<In>().data();
+  const In *in_vars = nullptr;
+  if constexpr (Variances)
+    in_vars = data.variances<In>().data();
+  const auto reduce_row = [&](Acc *vals, Acc *vars, const scipp::index group,
+                              const scipp::index row) {
+    for (scipp::index outer = 0; outer < n_outer; ++outer) {
+      const auto i = (outer * ngroup + group) * n_inner;
+      const auto j = (outer * nrow + row) * n_inner;
+      for (scipp::index inner = 0; inner < n_inner; ++inner)
+        apply_op<Variances>(op, vals, vars, i + inner, in_vals, in_vars,
+                            j + inner);
+    }
+  };
+
+  auto *vals = accum.values<Acc>().data();
+  Acc *vars = nullptr;
+  if constexpr (Variances)
+    vars = accum.variances<Acc>().data();
+  const auto size = accum.dims().volume();
+  // The number of input elements per output element equals the number of
+  // rows per group.
+  const auto n_chunk = core::partial_reduce::chunk_count(dims.volume(), size);
+  if (n_chunk <= 1) {
+    // Groups write to disjoint parts of the output, so no partial results are
+    // required. Slices of a group are in ascending order, so rows are reduced
+    // in the same order as in a sequential reduction.
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, ngroup), [&](const auto &range) {
+          for (auto group = range.begin(); group != range.end(); ++group)
+            for (const auto &slice : groups[group])
+              for (auto row = slice.begin(); row < slice.end(); ++row)
+                reduce_row(vals, vars, group, row);
+        });
+    return;
+  }
+
+  const auto rows = group_of_rows(groups, nrow);
+  const auto reduce_range = [&](Acc *out_vals, Acc *out_vars,
+                                const scipp::index begin,
+                                const scipp::index end) {
+    for (scipp::index row = begin; row < end; ++row)
+      if (const auto group = rows[row]; group >= 0)
+        reduce_row(out_vals, out_vars, group, row);
+  };
+
+  const core::partial_reduce::Partials<Acc> partial_vals(n_chunk, size);
+  const core::partial_reduce::Partials<Acc> partial_vars(
+      Variances ? n_chunk : 0, size);
+  core::partial_reduce::run(
+      n_chunk, nrow, size,
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        // Partial results are initialized with the initial values of the
+        // output, which must be neutral elements of `op`, such as zero for
+        // sums.
+        auto *part_vals = partial_vals[chunk].data();
+        Acc *part_vars = nullptr;
+        std::copy_n(vals, size, part_vals);
+        if constexpr (Variances) {
+          part_vars = partial_vars[chunk].data();
+          std::copy_n(vars, size, part_vars);
+        }
+        reduce_range(part_vals, part_vars, begin, end);
+      },
+      [&](const scipp::index chunk, const scipp::index begin,
+          const scipp::index end) {
+        const Acc *part_vars = Variances ? partial_vars[chunk].data() : nullptr;
+        for (auto i = begin; i != end; ++i)
+          apply_op<Variances>(op, vals, vars, i, partial_vals[chunk].data(),
+                              part_vars, i);
+      });
+}
+
+/// Reduce row by row if the combination of dtypes is supported, return false
+/// otherwise.
+template <class Acc, class In, class Op, class Groups>
+bool reduce_rows(Op op, Variable &accum, const Variable &data, const Dim dim,
+                 const Groups &groups) {
+  if constexpr (!supports<Op, Acc, In>) {
+    return false;
+  } else {
+    if (accum.dtype() != dtype<Acc> || data.dtype() != dtype<In>)
+      return false;
+    if constexpr (supports_variances<Op> && core::canHaveVariances<Acc>() &&
+                  core::canHaveVariances<In>()) {
+      if (data.has_variances() != accum.has_variances())
+        return false;
+      if (data.has_variances()) {
+        reduce_rows<Acc, In, true>(op, accum, data, dim, groups);
+        return true;
+      }
+    } else if (data.has_variances() || accum.has_variances()) {
+      return false;
+    }
+    reduce_rows<Acc, In, false>(op, accum, data, dim, groups);
+    return true;
+  }
+}
+
+template <class Op, class Groups>
+bool reduce_rows(Op op, Variable &accum, const Variable &data, const Dim dim,
+                 const Groups &groups) {
+  return reduce_rows<double, double>(op, accum, data, dim, groups) ||
+         reduce_rows<float, float>(op, accum, data, dim, groups) ||
+         reduce_rows<double, float>(op, accum, data, dim, groups) ||
+         reduce_rows<int64_t, int64_t>(op, accum, data, dim, groups) ||
+         reduce_rows<int32_t, int32_t>(op, accum, data, dim, groups) ||
+         reduce_rows<int64_t, bool>(op, accum, data, dim, groups) ||
+         reduce_rows<bool, bool>(op, accum, data, dim, groups);
+}
+
+/// Return true if reducing slice by slice would be slow, since there are many
+/// short slices.
+template <class Groups>
+bool has_short_slices(const Groups &groups, const scipp::index nrow) {
+  scipp::index nslice = 0;
+  for (const auto &group : groups)
+    nslice += scipp::size(group);
+  return nslice * min_rows_per_slice > nrow;
+}
+
+/// Return true if `out` and `in` have the same dims in the same order, except
+/// for `out_dim` in place of `in_dim`.
+bool has_matching_dims(const Dimensions &out, const Dimensions &in,
+                       const Dim out_dim, const Dim in_dim) {
+  if (out.ndim() != in.ndim())
+    return false;
+  for (scipp::index i = 0; i < in.ndim(); ++i)
+    if (in.label(i) == in_dim ? out.label(i) != out_dim
+                              : out.label(i) != in.label(i) ||
+                                    out.size(i) != in.size(i))
+      return false;
+  return true;
+}
+
+/// Reduce groups row by row. Returns false if this is not supported for the
+/// given inputs, in which case groups must be reduced slice by slice.
+template <class Op, class Groups>
+bool reduce_by_rows(const Reduction<Op> &reduction, const Variable &out_data,
+                    const Variable &in_data, const Dim reductionDim,
+                    const Dim dim, const Groups &groups) {
+  if (is_bins(in_data) || !in_data.dims().contains(reductionDim) ||
+      !has_default_layout(out_data) ||
+      !has_matching_dims(out_data.dims(), in_data.dims(), dim, reductionDim))
+    return false;
+  const auto nrow = in_data.dims()[reductionDim];
+  if (!has_short_slices(groups, nrow))
+    return false;
+  const auto data = has_default_layout(in_data) ? in_data : copy(in_data);
+  auto out = out_data;
+  if (reduction.accumulate_float_as_double &&
+      out_data.dtype() == dtype<float>) {
+    auto accum = astype(out_data, dtype<double>);
+    if (!reduce_rows(reduction.op, accum, data, reductionDim, groups))
+      return false;
+    copy(astype(accum, dtype<float>), out);
+    return true;
+  }
+  return reduce_rows(reduction.op, out, data, reductionDim, groups);
+}
+
 template <class Op, class Groups>
-void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
-             const DataArray &data, const Dim dim, const Groups &groups,
-             const FillValue fill) {
+void reduce_(const Reduction<Op> &reduction, const Dim reductionDim,
+             const Variable &out_data, const DataArray &data, const Dim dim,
+             const Dim sliceDim, const Groups &groups, const FillValue fill) {
   const auto mask_replacement =
       special_like(Variable(data.data(), Dimensions{}), fill);
   auto mask = irreducible_mask(data.masks(), reductionDim);
+  if (!is_bins(data.data()) && reductionDim == sliceDim) {
+    auto in_data = data.data();
+    if (mask.is_valid()) {
+      in_data = where(mask, mask_replacement, in_data);
+      if (in_data.dims() != data.dims())
+        in_data = transpose(in_data, data.dims().labels());
+    }
+    if (reduce_by_rows(reduction, out_data, in_data, reductionDim, dim, groups))
+      return;
+  }
   const auto process = [&](const auto &range) {
     // Apply to each group, storing result in output slice
     for (scipp::index group = range.begin(); group != range.end(); ++group) {
@@ -82,9 +343,10 @@ void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
       for (const auto &slice : groups[group]) {
         const auto data_slice = data.data().slice(slice);
         if (mask.is_valid())
-          op(out_slice, where(mask.slice(slice), mask_replacement, data_slice));
+          reduction.into(out_slice, where(mask.slice(slice), mask_replacement,
+                                          data_slice));
         else
-          op(out_slice, data_slice);
+          reduction.into(out_slice, data_slice);
       }
     }
   };
@@ -100,10 +362,11 @@ T GroupBy<T>::reduce(Op op, const Dim reductionDim,
   auto out = makeReductionOutput(reductionDim, fill);
   if constexpr (std::is_same_v<T, Dataset>) {
     for (const auto &item : m_data)
-      reduce_(op, reductionDim, out[item.name()].data(), item, dim(), groups(),
-              fill);
+      reduce_(op, reductionDim, out[item.name()].data(), item, dim(),
+              m_grouping.sliceDim(), groups(), fill);
   } else {
-    reduce_(op, reductionDim, out.data(), m_data, dim(), groups(), fill);
+    reduce_(op, reductionDim, out.data(), m_data, dim(), m_grouping.sliceDim(),
+            groups(), fill);
   }
   return out;
 }
@@ -127,42 +390,51 @@ template <class T> T GroupBy<T>::concat(const Dim reductionDim) const {
 
 /// Reduce each group using `sum` and return combined data.
 template <class T> T GroupBy<T>::sum(const Dim reductionDim) const {
-  return reduce(variable::sum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(Reduction{variable::sum_into, core::element::add_equals, true},
+                reductionDim, FillValue::ZeroNotBool);
 }
 
 /// Reduce each group using `nansum` and return combined data.
 template <class T> T GroupBy<T>::nansum(const Dim reductionDim) const {
-  return reduce(variable::nansum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(Reduction{variable::nansum_into, core::element::nan_add_equals},
+                reductionDim, FillValue::ZeroNotBool);
 }
 
 /// Reduce each group using `all` and return combined data.
 template <class T> T GroupBy<T>::all(const Dim reductionDim) const {
-  return reduce(variable::all_into, reductionDim, FillValue::True);
+  return reduce(
+      Reduction{variable::all_into, core::element::logical_and_equals},
+      reductionDim, FillValue::True);
 }
 
 /// Reduce each group using `any` and return combined data.
 template <class T> T GroupBy<T>::any(const Dim reductionDim) const {
-  return reduce(variable::any_into, reductionDim, FillValue::False);
+  return reduce(Reduction{variable::any_into, core::element::logical_or_equals},
+                reductionDim, FillValue::False);
 }
 
 /// Reduce each group using `max` and return combined data.
 template <class T> T GroupBy<T>::max(const Dim reductionDim) const {
-  return reduce(variable::max_into, reductionDim, FillValue::Lowest);
+  return reduce(Reduction{variable::max_into, core::element::max_equals},
+                reductionDim, FillValue::Lowest);
 }
 
 /// Reduce each group using `nanmax` and return combined data.
 template <class T> T GroupBy<T>::nanmax(const Dim reductionDim) const {
-  return reduce(variable::nanmax_into, reductionDim, FillValue::Lowest);
+  return reduce(Reduction{variable::nanmax_into, core::element::nanmax_equals},
+                reductionDim, FillValue::Lowest);
 }
 
 /// Reduce each group using `min` and return combined data.
 template <class T> T GroupBy<T>::min(const Dim reductionDim) const {
-  return reduce(variable::min_into, reductionDim, FillValue::Max);
+  return reduce(Reduction{variable::min_into, core::element::min_equals},
+                reductionDim, FillValue::Max);
 }
 
 /// Reduce each group using `nanmin` and return combined data.
 template <class T> T GroupBy<T>::nanmin(const Dim reductionDim) const {
-  return reduce(variable::nanmin_into, reductionDim, FillValue::Max);
+  return reduce(Reduction{variable::nanmin_into, core::element::nanmin_equals},
+                reductionDim, FillValue::Max);
 }
 
 /// Apply mean to groups and return combined data.
@@ -180,12 +452,21 @@ template <class T> T GroupBy<T>::mean(const Dim reductionDim) const {
     auto scale = makeVariable<double>(Dims{dim()}, Shape{size()});
     const auto scaleT = scale.template values<double>();
     const auto mask = irreducible_mask(data.masks(), reductionDim);
+    // Count masked rows directly for 1-D masks, avoiding a reduction per slice.
+    std::optional<std::span<const bool>> mask_values;
+    if (mask.is_valid() && mask.dims().ndim() == 1 &&
+        mask.dims().contains(reductionDim) && has_default_layout(mask))
+      mask_values = std::span<const bool>(mask.template values<bool>().data(),
+                                          mask.dims().volume());
     for (scipp::index group = 0; group < size(); ++group)
       for (const auto &slice : groups()[group]) {
         // N contributing to each slice
         scaleT[group] += slice.end() - slice.begin();
         // N masks for each slice, that need to be subtracted
-        if (mask.is_valid()) {
+        if (mask_values) {
+          scaleT[group] -= std::count(mask_values->begin() + slice.begin(),
+                                      mask_values->begin() + slice.end(), true);
+        } else if (mask.is_valid()) {
           const auto masks_sum = variable::sum(mask.slice(slice), reductionDim);
           scaleT[group] -= masks_sum.template value<int64_t>();
         }
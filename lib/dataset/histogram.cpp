@@ -59,13 +59,6 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
           const auto cont_data = as_contiguous(data, event_dim_);
           const auto cont_coord =
               as_contiguous(events_.coords()[dim], event_dim_);
-          if (data.ndim() == 1 && data.dims().volume() > 100000) {
-            const DataArray content(cont_data, {{dim, cont_coord}});
-            const auto binned =
-                pretend_bins_for_threading(content, Dim::InternalHistogram);
-            // This sums automatically over Dim::InternalHistogram
-            return buckets::histogram(binned, binEdges_);
-          }
           // Due to the combinatoric explosion of dtype combinations, we promote
           // either the bin edges or the coord in case their dtypes mismatch.
           // This is less efficient, but hopefully an edge case. If performance
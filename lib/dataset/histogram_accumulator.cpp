@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "scipp/core/element/histogram.h"
+#include "scipp/dataset/except.h"
+#include "scipp/dataset/histogram.h"
+#include "scipp/dataset/histogram_accumulator.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/subspan_view.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/util.h"
+
+#include "bins_util.h"
+#include "dataset_operations_common.h"
+
+using namespace scipp::core;
+using namespace scipp::variable;
+
+namespace scipp::dataset {
+
+namespace {
+Dimensions erase(Dimensions dims, const Dim dim) {
+  if (dims.contains(dim))
+    dims.erase(dim);
+  return dims;
+}
+} // namespace
+
+HistogramAccumulator::HistogramAccumulator(const Variable &edges)
+    : m_edges(copy(edges).as_const()), m_dim(edges.dims().inner()) {}
+
+/// Add the histogram of a batch of events to the accumulated histogram.
+///
+/// Masks of `events` are applied. Dense and binned `events` are histogrammed
+/// directly into the back buffer, without creating an intermediate histogram.
+void HistogramAccumulator::add(const DataArray &events) {
+  const std::scoped_lock lock(m_add_mutex);
+  update_back_buffer();
+  add_to_back_buffer(events);
+  // The caller may modify `events` after this call.
+  m_last_batch = copy(events);
+  publish();
+}
+
+/// Set all bins of the accumulated histogram to zero.
+void HistogramAccumulator::reset() {
+  const std::scoped_lock lock(m_add_mutex);
+  if (!m_buffers[m_front].is_valid())
+    return;
+  m_last_batch.reset();
+  fill_zeros(reusable_back_buffer());
+  publish();
+}
+
+/// Return the accumulated histogram as of the last completed `add` or `reset`.
+///
+/// The returned data is read-only and remains valid and unchanged while
+/// further batches are added.
+DataArray HistogramAccumulator::snapshot() const {
+  Variable data;
+  {
+    const std::scoped_lock lock(m_publish_mutex);
+    data = m_published;
+  }
+  if (!data.is_valid())
+    throw std::runtime_error(
+        "Cannot create snapshot of HistogramAccumulator before adding events.");
+  return DataArray(data, {{m_dim, m_edges}});
+}
+
+/// Return the back buffer, with undefined content.
+///
+/// The back buffer is not published anymore. It is reused unless a snapshot
+/// still references it, in which case it is replaced by a new buffer.
+Variable &HistogramAccumulator::reusable_back_buffer() {
+  auto &back = m_buffers[1 - m_front];
+  if (!back.is_valid() || back.data_handle().use_count() > 1)
+    back = empty_like(m_buffers[m_front]);
+  return back;
+}
+
+/// Bring the back buffer up to date with the front buffer.
+///
+/// After publishing, the previous front buffer becomes the back buffer, which
+/// lacks only the last batch. Adding that batch again costs only the size of
+/// the batch. The front buffer is copied instead if the back buffer is still
+/// referenced by a snapshot, or if the last `add` or `reset` failed.
+void HistogramAccumulator::update_back_buffer() {
+  const auto &front = m_buffers[m_front];
+  if (!front.is_valid())
+    return;
+  const auto &back = m_buffers[1 - m_front];
+  // Reset first, so a failure below leaves the back buffer marked as stale.
+  const auto batch = std::exchange(m_last_batch, std::nullopt);
+  if (batch && back.is_valid() && back.data_handle().use_count() == 1)
+    add_to_back_buffer(*batch);
+  else
+    copy(front, reusable_back_buffer());
+}
+
+/// Return the back buffer.
+///
+/// Before the first `add` the back buffer is created with the given `dims` and
+/// the dtype, unit, and variances of `weights`.
+Variable &HistogramAccumulator::back_buffer(const Dimensions &dims,
+                                            const Variable &weights) {
+  auto &back = m_buffers[1 - m_front];
+  if (!m_buffers[m_front].is_valid()) {
+    back = empty(dims, weights.unit(), weights.dtype(),
+                 weights.has_variances());
+    fill_zeros(back);
+  }
+  return back;
+}
+
+void HistogramAccumulator::add_to_back_buffer(const DataArray &events) {
+  if (events.dtype() == dtype<bucket<DataArray>>)
+    add_binned(events);
+  else
+    add_dense(events);
+}
+
+void HistogramAccumulator::add_dense(const DataArray &events) {
+  if (is_histogram(events, m_dim))
+    throw except::BinEdgeError(
+        "Data is already histogrammed. Expected event data or dense point "
+        "data, got data with bin edges.");
+  const auto event_dim = events.coords().dim_of(m_dim);
+  const auto data = masked_data(events, event_dim);
+  // See `histogram` regarding lifetime of `as_contiguous` and dtype promotion.
+  const auto cont_data = as_contiguous(data, event_dim);
+  const auto cont_coord = as_contiguous(events.coords()[m_dim], event_dim);
+  const auto dt = common_type(m_edges, cont_coord);
+  const auto coord = astype(cont_coord, dt, CopyPolicy::TryAvoid);
+  const auto edges = astype(m_edges, dt, CopyPolicy::TryAvoid);
+  auto dims =
+      merge(erase(data.dims(), event_dim), erase(m_edges.dims(), m_dim));
+  dims.addInner(m_dim, m_edges.dims()[m_dim] - 1);
+  transform_in_place(subspan_view(back_buffer(dims, data), m_dim),
+                     subspan_view(coord, event_dim),
+                     subspan_view(cont_data, event_dim),
+                     subspan_view(edges, m_dim), element::histogram_add,
+                     "histogram");
+}
+
+void HistogramAccumulator::add_binned(const DataArray &events) {
+  const auto data = hide_masked(events.data(), events.masks(),
+                                std::span<const Dim>{&m_dim, 1});
+  const auto &[indices, dim, buffer] = data.constituents<DataArray>();
+  const auto masked = masked_data(buffer, dim);
+  const auto dt = common_type(m_edges, buffer.coords()[m_dim]);
+  const auto coord = astype(buffer.coords()[m_dim], dt, CopyPolicy::TryAvoid);
+  const auto edges = astype(m_edges, dt, CopyPolicy::TryAvoid);
+  auto dims = merge(erase(indices.dims(), m_dim), erase(m_edges.dims(), m_dim));
+  dims.addInner(m_dim, m_edges.dims()[m_dim] - 1);
+  auto hist = subspan_view(back_buffer(dims, masked), m_dim);
+  const auto add_bins = [&](const Variable &bin_indices) {
+    transform_in_place(hist, subspan_view(coord, dim, bin_indices),
+                       subspan_view(masked, dim, bin_indices),
+                       subspan_view(edges, m_dim), element::histogram_add,
+                       "histogram");
+  };
+  if (!indices.dims().contains(m_dim))
+    return add_bins(indices);
+  // All bins along the histogrammed dim contribute to the same output bins.
+  for (scipp::index i = 0; i < indices.dims()[m_dim]; ++i)
+    add_bins(indices.slice({m_dim, i}));
+}
+
+void HistogramAccumulator::publish() {
+  m_front = 1 - m_front;
+  auto published = m_buffers[m_front].as_const();
+  const std::scoped_lock lock(m_publish_mutex);
+  std::swap(m_published, published);
+}
+
+} // namespace scipp::dataset
@@ -60,6 +60,12 @@ namespace scipp::dataset::buckets {
 SCIPP_DATASET_EXPORT void append(Variable &var0, const Variable &var1);
 SCIPP_DATASET_EXPORT void append(DataArray &a, const DataArray &b);
 
+SCIPP_DATASET_EXPORT void extend(Variable &var0, const Variable &var1);
+SCIPP_DATASET_EXPORT void extend(DataArray &a, const DataArray &b);
+
+SCIPP_DATASET_EXPORT void compact(Variable &var);
+SCIPP_DATASET_EXPORT void compact(DataArray &a);
+
 [[nodiscard]] SCIPP_DATASET_EXPORT Variable histogram(const Variable &data,
                                                       const Variable &binEdges);
 
@@ -12,6 +12,10 @@ template <class T>
 [[nodiscard]] T extract_ranges(const Variable &indices, const T &data,
                                const Dim dim);
 
+template <class T>
+[[nodiscard]] T extract_indices(const Variable &indices, const T &data,
+                                const Dim dim);
+
 SCIPP_DATASET_EXPORT Variable extract(const Variable &var,
                                       const Variable &condition);
 SCIPP_DATASET_EXPORT DataArray extract(const DataArray &da,
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset {
+
+/// Accumulate the histogram of a stream of event batches.
+///
+/// Bin edges are fixed on construction. The histogram is double buffered: Each
+/// batch is histogrammed directly into the buffer that is not published, which
+/// is then published in place of the other one. `snapshot` therefore never
+/// waits for an ongoing `add`. The buffer that is not published is brought up
+/// to date by adding the previous batch again, so the cost of `add` is
+/// proportional to the size of the batch rather than that of the histogram.
+/// Calls to `add` and `reset` are serialized.
+class SCIPP_DATASET_EXPORT HistogramAccumulator {
+public:
+  explicit HistogramAccumulator(const Variable &edges);
+
+  void add(const DataArray &events);
+  void reset();
+  [[nodiscard]] DataArray snapshot() const;
+  [[nodiscard]] const Variable &edges() const noexcept { return m_edges; }
+
+private:
+  Variable &reusable_back_buffer();
+  void update_back_buffer();
+  Variable &back_buffer(const Dimensions &dims, const Variable &weights);
+  void add_to_back_buffer(const DataArray &events);
+  void add_dense(const DataArray &events);
+  void add_binned(const DataArray &events);
+  void publish();
+
+  Variable m_edges;
+  Dim m_dim;
+  /// Front and back buffer, `m_front` is the index of the published one.
+  std::array<Variable, 2> m_buffers;
+  scipp::index m_front{0};
+  /// Batch added to the front buffer but not to the back buffer, if the back
+  /// buffer is otherwise equal to the front buffer.
+  std::optional<DataArray> m_last_batch;
+  /// Read-only view of the front buffer, returned by `snapshot`.
+  Variable m_published;
+  std::mutex m_add_mutex;
+  mutable std::mutex m_publish_mutex;
+};
+
+} // namespace scipp::dataset
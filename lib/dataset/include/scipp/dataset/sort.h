@@ -25,3 +25,11 @@ SCIPP_DATASET_EXPORT Dataset sort(const Dataset &dataset, const Dim &key,
                                   const SortOrder order = SortOrder::Ascending);
 
 } // namespace scipp::dataset
+
+namespace scipp::dataset::buckets {
+
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+sort(const DataArray &array, const Dim key,
+     const SortOrder order = SortOrder::Ascending);
+
+} // namespace scipp::dataset::buckets
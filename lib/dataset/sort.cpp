@@ -2,10 +2,16 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <numeric>
+#include <span>
+
 #include "scipp/dataset/sort.h"
+#include "scipp/core/argsort.h"
 #include "scipp/core/parallel.h"
 #include "scipp/core/tag_util.h"
+#include "scipp/dataset/bins.h"
 #include "scipp/dataset/extract.h"
+#include "scipp/variable/util.h"
 
 namespace scipp::dataset {
 
@@ -20,35 +26,12 @@ constexpr auto nan_sensitive_less = [](const auto &a, const auto &b) {
 
 template <class T> struct IndicesForSorting {
   static Variable apply(const Variable &key, const SortOrder order) {
-    const auto size = key.dims()[key.dim()];
-    const auto values = key.values<T>();
-    std::vector<std::pair<T, scipp::index>> key_index;
-    key_index.reserve(size);
-
-    {
-      scipp::index i = 0;
-      for (const auto &value : key.values<T>())
-        key_index.emplace_back(value, i++);
-    }
-
-    if (order == SortOrder::Ascending)
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(a.first, b.first);
-          });
-    else
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(b.first, a.first);
-          });
-
+    const auto contiguous = as_contiguous(key, key.dim());
+    const auto perm = core::argsort(contiguous.values<T>().as_span(), order);
     auto indices =
-        makeVariable<scipp::index_pair>(Dims{key.dim()}, Shape{size});
-    std::transform(key_index.begin(), key_index.end(),
-                   indices.values<scipp::index_pair>().as_span().begin(),
-                   [](const auto &item) {
-                     return std::pair{item.second, item.second + 1};
-                   });
+        makeVariable<int64_t>(Dims{key.dim()}, Shape{scipp::size(perm)});
+    std::copy(perm.begin(), perm.end(),
+              indices.values<int64_t>().as_span().begin());
     return indices;
   }
 };
@@ -68,19 +51,100 @@ void require_same_shape(const Dimensions &var_dims, const Dimensions &key_dims,
         std::to_string(var_dims[dim]) + ". Lengths must agree.");
 }
 
+/// Bins with string keys and more events than this are sorted using a parallel
+/// sort. Smaller bins are sorted sequentially, but many bins are processed in
+/// parallel.
+constexpr scipp::index parallel_bin_sort_threshold = 65536;
+
+template <class T> struct PermutationForSortingBins {
+  /// Return, for every event of the output buffer, the position of the event in
+  /// the input buffer. Output bins are contiguous and in the order of `ranges`.
+  static std::vector<scipp::index>
+  apply(const Variable &key, const std::vector<scipp::index_pair> &ranges,
+        const std::vector<scipp::index> &offsets, const SortOrder order) {
+    const auto values = key.values<T>().as_span();
+    if constexpr (!std::is_same_v<T, std::string>) {
+      // Sort by (bin index, key), using a radix sort for large bins.
+      static_cast<void>(offsets);
+      return core::argsort(std::span<const T>(values),
+                           std::span<const scipp::index_pair>(ranges), order);
+    } else {
+      std::vector<scipp::index> perm(offsets.back());
+      // Ties are broken by position, so the result does not depend on the
+      // sorting algorithm and the order of events with equal keys is preserved.
+      const auto compare = [order](const auto &a, const auto &b) {
+        if (order == SortOrder::Ascending) {
+          if (nan_sensitive_less(a.first, b.first))
+            return true;
+          if (nan_sensitive_less(b.first, a.first))
+            return false;
+        } else {
+          if (nan_sensitive_less(b.first, a.first))
+            return true;
+          if (nan_sensitive_less(a.first, b.first))
+            return false;
+        }
+        return a.second < b.second;
+      };
+      const auto sort_bin = [&](const scipp::index bin, auto &key_index,
+                                const auto &sort) {
+        const auto [begin, end] = ranges[bin];
+        key_index.clear();
+        for (scipp::index i = begin; i < end; ++i)
+          key_index.emplace_back(values[i], i);
+        sort(key_index.begin(), key_index.end(), compare);
+        std::transform(key_index.begin(), key_index.end(),
+                       perm.begin() + offsets[bin],
+                       [](const auto &item) { return item.second; });
+      };
+      const auto nbin = scipp::size(ranges);
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, nbin), [&](const auto &range) {
+            // Reused for all bins of this chunk.
+            std::vector<std::pair<T, scipp::index>> key_index;
+            for (scipp::index bin = range.begin(); bin < range.end(); ++bin)
+              if (offsets[bin + 1] - offsets[bin] <=
+                  parallel_bin_sort_threshold)
+                sort_bin(bin, key_index, [](auto &&...args) {
+                  std::sort(std::forward<decltype(args)>(args)...);
+                });
+          });
+      std::vector<std::pair<T, scipp::index>> key_index;
+      for (scipp::index bin = 0; bin < nbin; ++bin)
+        if (offsets[bin + 1] - offsets[bin] > parallel_bin_sort_threshold)
+          sort_bin(bin, key_index, [](auto &&...args) {
+            core::parallel::parallel_sort(
+                std::forward<decltype(args)>(args)...);
+          });
+      return perm;
+    }
+  }
+};
+
+std::vector<scipp::index>
+permutation_for_sorting_bins(const Variable &key,
+                             const std::vector<scipp::index_pair> &ranges,
+                             const std::vector<scipp::index> &offsets,
+                             const SortOrder order) {
+  return core::CallDType<double, float, int64_t, int32_t, bool, std::string,
+                         core::time_point>::
+      apply<PermutationForSortingBins>(key.dtype(), key, ranges, offsets,
+                                       order);
+}
+
 } // namespace
 
 /// Return a Variable sorted based on key.
 Variable sort(const Variable &var, const Variable &key, const SortOrder order) {
   require_same_shape(var.dims(), key.dims(), key.dim());
-  return extract_ranges(indices_for_sorting(key, order), var, key.dim());
+  return extract_indices(indices_for_sorting(key, order), var, key.dim());
 }
 
 /// Return a DataArray sorted based on key.
 DataArray sort(const DataArray &array, const Variable &key,
                const SortOrder order) {
   require_same_shape(array.dims(), key.dims(), key.dim());
-  return extract_ranges(indices_for_sorting(key, order), array, key.dim());
+  return extract_indices(indices_for_sorting(key, order), array, key.dim());
 }
 
 /// Return a DataArray sorted based on coordinate.
@@ -91,7 +155,8 @@ DataArray sort(const DataArray &array, const Dim &key, const SortOrder order) {
 /// Return a Dataset sorted based on key.
 Dataset sort(const Dataset &dataset, const Variable &key,
              const SortOrder order) {
-  return extract_ranges(indices_for_sorting(key, order), dataset, key.dim());
+  return extract_indices(indices_for_sorting(key, order), dataset,
+                         key.dim());
 }
 
 /// Return a Dataset sorted based on coordinate.
@@ -100,3 +165,41 @@ Dataset sort(const Dataset &dataset, const Dim &key, const SortOrder order) {
 }
 
 } // namespace scipp::dataset
+
+namespace scipp::dataset::buckets {
+
+/// Return binned data with the events within every bin sorted based on the
+/// event coordinate `key`.
+///
+/// Events with equal keys remain in their original order. The buffer of the
+/// output contains only the events of the bins, in the order of the bins.
+DataArray sort(const DataArray &array, const Dim key, const SortOrder order) {
+  const auto &[indices, dim, buffer] = array.data().constituents<DataArray>();
+  std::vector<scipp::index_pair> ranges;
+  ranges.reserve(indices.dims().volume());
+  for (const auto &range : indices.values<scipp::index_pair>())
+    ranges.push_back(range);
+  std::vector<scipp::index> offsets(ranges.size() + 1);
+  std::transform_inclusive_scan(
+      ranges.begin(), ranges.end(), offsets.begin() + 1, std::plus{},
+      [](const auto &range) { return range.second - range.first; });
+  const auto perm = permutation_for_sorting_bins(buffer.coords()[key], ranges,
+                                                 offsets, order);
+
+  auto gather = makeVariable<int64_t>(Dims{dim}, Shape{scipp::size(perm)});
+  std::copy(perm.begin(), perm.end(),
+            gather.values<int64_t>().as_span().begin());
+  auto sorted_buffer = extract_indices(gather, buffer, dim);
+
+  auto out_indices = makeVariable<scipp::index_pair>(indices.dims());
+  std::transform(offsets.begin(), offsets.end() - 1, offsets.begin() + 1,
+                 out_indices.values<scipp::index_pair>().as_span().begin(),
+                 [](const auto begin, const auto end) {
+                   return std::pair{begin, end};
+                 });
+  return DataArray{make_bins_no_validate(std::move(out_indices), dim,
+                                         std::move(sorted_buffer)),
+                   copy(array.coords()), copy(array.masks()), array.name()};
+}
+
+} // namespace scipp::dataset::buckets
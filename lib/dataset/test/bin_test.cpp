@@ -2,6 +2,8 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "dataset_test_common.h"
 #include "random.h"
 
@@ -634,6 +636,21 @@ TEST(BinLinspaceTest, many_events_many_bins) {
   EXPECT_EQ(sum(bin(da, {edges}).data()), sum(da.data()));
 }
 
+TEST(BinLinspaceTest, two_pass_many_bins) {
+  Random rand(0.0, 1.0);
+  rand.seed(0);
+  const Dimensions dims(Dim::Row, 100000);
+  std::vector<double> rows(dims.volume());
+  std::iota(rows.begin(), rows.end(), 0.0);
+  const auto data = makeVariable<double>(dims, Values(rows));
+  const auto x = makeVariable<double>(dims, Values(rand(dims.volume())));
+  auto da = DataArray(data, {{Dim::X, x}});
+  const auto edges =
+      linspace(0.0 * sc_units::one, 1.0 * sc_units::one, Dim::X, 1200001);
+  const auto binned = bin(da, {edges});
+  EXPECT_EQ(bins_sum(binned).data(), histogram(da, edges).data());
+}
+
 TEST(BinEdgeTest, edge_reference_prereserved) {
   const auto table = make_table(10);
   const auto x_edges =
@@ -15,6 +15,7 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/reduction.h"
+#include "scipp/variable/take.h"
 #include "scipp/variable/variable_factory.h"
 
 using namespace scipp;
@@ -59,6 +60,17 @@ TEST_F(DataArrayBinsTest, concatenate_dim_1d_masked) {
   EXPECT_EQ(buckets::concatenate(a, Dim::Y), expected);
 }
 
+TEST_F(DataArrayBinsTest, take_shares_buffer) {
+  const auto indices_ =
+      makeVariable<int64_t>(Dims{Dim::Y}, Shape{3}, Values{1, 1, 0});
+  const auto taken = variable::take(var, indices_, Dim::Y);
+  EXPECT_EQ(taken.slice({Dim::Y, 0}), var.slice({Dim::Y, 1}));
+  EXPECT_EQ(taken.slice({Dim::Y, 1}), var.slice({Dim::Y, 1}));
+  EXPECT_EQ(taken.slice({Dim::Y, 2}), var.slice({Dim::Y, 0}));
+  EXPECT_EQ(&taken.bin_buffer<DataArray>().data().values<double>()[0],
+            &var.bin_buffer<DataArray>().data().values<double>()[0]);
+}
+
 TEST(DataArrayBins2dTest, concatenate_dim_2d) {
   Variable indicesZY =
       makeVariable<scipp::index_pair>(Dims{Dim::Z, Dim::Y}, Shape{2, 2},
@@ -483,6 +495,99 @@ TEST_F(DataArrayBinsPlusMinusTest, minus_equals) {
   EXPECT_EQ(out, buckets::concatenate(a, -b));
 }
 
+TEST_F(DataArrayBinsPlusMinusTest, extend) {
+  auto out = copy(a);
+  buckets::extend(out, b);
+  EXPECT_EQ(out, buckets::concatenate(a, b));
+  buckets::extend(out, a);
+  EXPECT_EQ(out, buckets::concatenate(buckets::concatenate(a, b), a));
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_uses_spare_capacity) {
+  auto out = copy(a);
+  buckets::extend(out, b);
+  // Note that holding a copy of the buffer would prevent in-place extension.
+  const auto *data =
+      out.data().bin_buffer<DataArray>().data().values<double>().data();
+  // Capacity is sufficient, so the buffer is not reallocated.
+  buckets::extend(out, a);
+  EXPECT_EQ(out.data().bin_buffer<DataArray>().data().values<double>().data(),
+            data);
+  EXPECT_EQ(out, buckets::concatenate(buckets::concatenate(a, b), a));
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_self) {
+  auto out = copy(a);
+  buckets::extend(out, out);
+  EXPECT_EQ(out, buckets::concatenate(a, a));
+  buckets::extend(out, out);
+  EXPECT_EQ(out, buckets::concatenate(buckets::concatenate(a, a),
+                                      buckets::concatenate(a, a)));
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_is_seen_by_aliases) {
+  auto out = copy(a);
+  const Variable alias(out.data());
+  // No spare capacity, the buffer is reallocated.
+  buckets::extend(out, b);
+  EXPECT_EQ(alias, buckets::concatenate(a, b).data());
+  const auto *data =
+      out.data().bin_buffer<DataArray>().data().values<double>().data();
+  // Extend via a variable sharing the bins, using spare capacity.
+  auto data_alias = out.data();
+  buckets::extend(data_alias, a.data());
+  EXPECT_EQ(out.data().bin_buffer<DataArray>().data().values<double>().data(),
+            data);
+  const auto expected = buckets::concatenate(buckets::concatenate(a, b), a);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(alias, expected.data());
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_slice_throws) {
+  auto out = copy(a);
+  buckets::extend(out, b);
+  const auto original = copy(out);
+  auto slice = out.slice({Dim::Y, 0});
+  EXPECT_THROW(buckets::extend(slice, a.slice({Dim::Y, 0})),
+               except::DimensionError);
+  EXPECT_EQ(out, original);
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_shared_buffer_reallocates) {
+  const auto original = copy(a);
+  // The first bin of `taken` could use the second bin of `a` as capacity.
+  DataArray taken(variable::take(
+      a.data(), makeVariable<int64_t>(Dims{Dim::Y}, Shape{1}, Values{0}),
+      Dim::Y));
+  const auto expected =
+      buckets::concatenate(copy(taken), b.slice({Dim::Y, 0, 1}));
+  buckets::extend(taken, b.slice({Dim::Y, 0, 1}));
+  EXPECT_EQ(taken, expected);
+  EXPECT_EQ(a, original);
+  EXPECT_NE(&taken.data().bin_buffer<DataArray>().data().values<double>()[0],
+            &a.data().bin_buffer<DataArray>().data().values<double>()[0]);
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, extend_buffer_referenced_elsewhere) {
+  auto out = copy(a);
+  buckets::extend(out, b);
+  const auto buffer = out.data().bin_buffer<DataArray>();
+  const auto original = copy(buffer);
+  buckets::extend(out, a);
+  EXPECT_EQ(out, buckets::concatenate(buckets::concatenate(a, b), a));
+  EXPECT_EQ(buffer, original);
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, compact) {
+  auto out = copy(a);
+  buckets::extend(out, b);
+  buckets::compact(out);
+  EXPECT_EQ(out.data().bin_buffer<DataArray>().dims()[Dim("event")],
+            a.data().bin_buffer<DataArray>().dims()[Dim("event")] +
+                b.data().bin_buffer<DataArray>().dims()[Dim("event")]);
+  EXPECT_EQ(out, buckets::concatenate(a, b));
+}
+
 class DatasetBinsTest : public ::testing::Test {
 protected:
   Dimensions dims{Dim::Y, 2};
@@ -8,9 +8,12 @@
 #include "scipp/dataset/groupby.h"
 #include "scipp/dataset/mean.h"
 #include "scipp/dataset/shape.h"
+#include "scipp/dataset/sort.h"
 #include "scipp/dataset/sum.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/comparison.h"
+#include "scipp/variable/generated_comparison.h"
 #include "scipp/variable/shape.h"
 
 #include "test_macros.h"
@@ -754,6 +757,130 @@ TEST(GroupbyLargeTest, sum) {
   EXPECT_EQ(sum(grouped), sum(da));
 }
 
+namespace {
+Variable without_variances(const Variable &var) {
+  auto out = copy(var);
+  out.setVariances(Variable());
+  return out;
+}
+} // namespace
+
+struct GroupbyUnsortedTest : public ::testing::Test {
+  GroupbyUnsortedTest() {
+    const scipp::index nrow = 100000;
+    auto values = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, nrow},
+                                       sc_units::m, Values{}, Variances{});
+    auto key = makeVariable<int64_t>(Dims{Dim::X}, Shape{nrow});
+    mask = makeVariable<bool>(Dims{Dim::X}, Shape{nrow});
+    for (scipp::index i = 0; i < nrow; ++i) {
+      key.values<int64_t>()[i] = (i * 7919) % 17;
+      mask.values<bool>()[i] = i % 11 == 0;
+      for (scipp::index y = 0; y < 2; ++y) {
+        values.values<double>()[y * nrow + i] = (i % 13) + y;
+        values.variances<double>()[y * nrow + i] = i % 5;
+      }
+    }
+    da = DataArray(values, {{Dim::Z, key}});
+    masked = da;
+    masked.masks().set("mask", mask);
+    // Rows with equal keys are contiguous after sorting, so the reference is
+    // computed by reducing slices.
+    sorted = sort(da, Dim::Z);
+    sorted_masked = sort(masked, Dim::Z);
+  }
+
+  DataArray da;
+  DataArray sorted;
+  DataArray masked;
+  DataArray sorted_masked;
+  Variable mask;
+};
+
+TEST_F(GroupbyUnsortedTest, sum) {
+  EXPECT_EQ(groupby(da, Dim::Z).sum(Dim::X),
+            groupby(sorted, Dim::Z).sum(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, sum_masked) {
+  EXPECT_EQ(groupby(masked, Dim::Z).sum(Dim::X),
+            groupby(sorted_masked, Dim::Z).sum(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, sum_transposed) {
+  const auto transposed = transpose(da);
+  EXPECT_EQ(groupby(transposed, Dim::Z).sum(Dim::X),
+            transpose(groupby(sorted, Dim::Z).sum(Dim::X)));
+}
+
+TEST_F(GroupbyUnsortedTest, mean_masked) {
+  EXPECT_EQ(groupby(masked, Dim::Z).mean(Dim::X),
+            groupby(sorted_masked, Dim::Z).mean(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, min_max) {
+  da.setData(without_variances(da.data()));
+  sorted.setData(without_variances(sorted.data()));
+  EXPECT_EQ(groupby(da, Dim::Z).min(Dim::X),
+            groupby(sorted, Dim::Z).min(Dim::X));
+  EXPECT_EQ(groupby(da, Dim::Z).max(Dim::X),
+            groupby(sorted, Dim::Z).max(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, nansum) {
+  da.setData(without_variances(da.data()));
+  da.data().values<double>()[7] = std::numeric_limits<double>::quiet_NaN();
+  sorted = sort(da, Dim::Z);
+  EXPECT_EQ(groupby(da, Dim::Z).nansum(Dim::X),
+            groupby(sorted, Dim::Z).nansum(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, float32) {
+  da.setData(astype(without_variances(da.data()), dtype<float>));
+  sorted.setData(astype(without_variances(sorted.data()), dtype<float>));
+  EXPECT_EQ(groupby(da, Dim::Z).sum(Dim::X),
+            groupby(sorted, Dim::Z).sum(Dim::X));
+}
+
+TEST_F(GroupbyUnsortedTest, few_rows_per_group) {
+  // Too few rows per group for partial results, groups are reduced in
+  // parallel instead.
+  auto key = copy(da.coords()[Dim::Z]);
+  for (scipp::index i = 0; i < key.dims().volume(); ++i)
+    key.values<int64_t>()[i] = (i * 7919) % 40000;
+  da.coords().set(Dim::Z, key);
+  sorted = sort(da, Dim::Z);
+  EXPECT_EQ(groupby(da, Dim::Z).sum(Dim::X),
+            groupby(sorted, Dim::Z).sum(Dim::X));
+}
+
+TEST(GroupbyUnsortedFloat32Test, nansum_rounds_every_row) {
+  const scipp::index nrow = 2002;
+  auto values = makeVariable<float>(Dims{Dim::X}, Shape{nrow}, sc_units::m);
+  auto key = makeVariable<int64_t>(Dims{Dim::X}, Shape{nrow});
+  for (scipp::index i = 0; i < nrow; ++i) {
+    key.values<int64_t>()[i] = i % 2;
+    values.values<float>()[i] = i < 2 ? 1e8f : 1.0f;
+  }
+  const DataArray da(values, {{Dim::Z, key}});
+  // Every row is a separate slice and nansum_into rounds to float32 after each
+  // slice, so adding 1 to 1e8 has no effect.
+  EXPECT_EQ(groupby(da, Dim::Z).nansum(Dim::X).data(),
+            makeVariable<float>(Dims{Dim::Z}, Shape{2}, sc_units::m,
+                                Values{1e8f, 1e8f}));
+}
+
+TEST_F(GroupbyUnsortedTest, any_all) {
+  da.setData(greater(without_variances(da.data()), 6.0 * sc_units::m));
+  sorted.setData(
+      greater(without_variances(sorted.data()), 6.0 * sc_units::m));
+  EXPECT_EQ(groupby(da, Dim::Z).any(Dim::X),
+            groupby(sorted, Dim::Z).any(Dim::X));
+  EXPECT_EQ(groupby(da, Dim::Z).all(Dim::X),
+            groupby(sorted, Dim::Z).all(Dim::X));
+  EXPECT_EQ(groupby(da, Dim::Z).sum(Dim::X),
+            groupby(sorted, Dim::Z).sum(Dim::X));
+}
+
 TEST_F(GroupbyWithBinsTest, groupby_reference_prereserved) {
   auto bins = makeVariable<double>(Dims{Dim::Z}, Shape{4}, sc_units::m,
                                    Values{0.0, 1.0, 2.0, 3.0});
@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/dataset/histogram.h"
+#include "scipp/dataset/histogram_accumulator.h"
+#include "scipp/dataset/shape.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/comparison.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+struct HistogramAccumulatorTest : public ::testing::Test {
+protected:
+  HistogramAccumulatorTest() {
+    const auto data = makeVariable<double>(
+        Dims{Dim::Event}, Shape{10}, sc_units::counts,
+        Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        Variances{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    const auto coord = makeVariable<double>(
+        Dims{Dim::Event}, Shape{10}, Values{1, 2, 1, 2, 3, 4, 3, 2, 1, 1});
+    events = DataArray(data, {{Dim::X, coord}});
+  }
+  DataArray events;
+  Variable edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+};
+
+TEST_F(HistogramAccumulatorTest, snapshot_before_add_throws) {
+  HistogramAccumulator accumulator(edges);
+  EXPECT_THROW(static_cast<void>(accumulator.snapshot()), std::runtime_error);
+}
+
+TEST_F(HistogramAccumulatorTest, add_once_equals_histogram) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  EXPECT_EQ(accumulator.snapshot(), histogram(events, edges));
+}
+
+TEST_F(HistogramAccumulatorTest, add_accumulates) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  accumulator.add(events);
+  accumulator.add(events.slice({Dim::Event, 0, 4}));
+  EXPECT_EQ(accumulator.snapshot(),
+            histogram(concat(std::vector{events, events,
+                                         events.slice({Dim::Event, 0, 4})},
+                             Dim::Event),
+                      edges));
+}
+
+TEST_F(HistogramAccumulatorTest, linspace_and_sorted_edges) {
+  const auto sorted =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 2.5, 4});
+  for (const auto &e : {edges, sorted}) {
+    HistogramAccumulator accumulator(e);
+    accumulator.add(events);
+    accumulator.add(events);
+    const auto single = histogram(events, e).data();
+    EXPECT_EQ(accumulator.snapshot().data(), single + single);
+  }
+}
+
+TEST_F(HistogramAccumulatorTest, masks_are_applied) {
+  auto masked = copy(events);
+  masked.masks().set("mask", less(masked.data(), 4.0 * sc_units::counts));
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(masked);
+  accumulator.add(events);
+  EXPECT_EQ(accumulator.snapshot().data(),
+            histogram(masked, edges).data() + histogram(events, edges).data());
+}
+
+TEST_F(HistogramAccumulatorTest, binned_events) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 4}, std::pair{4, 10}});
+  const DataArray binned(make_bins(indices, Dim::Event, events));
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(binned);
+  accumulator.add(binned);
+  const auto single = histogram(binned, edges).data();
+  EXPECT_EQ(accumulator.snapshot().data(), single + single);
+}
+
+TEST_F(HistogramAccumulatorTest, binned_along_histogrammed_dim) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y, Dim::X}, Shape{2, 2},
+      Values{std::pair{0, 2}, std::pair{2, 4}, std::pair{4, 7},
+             std::pair{7, 10}});
+  DataArray binned(make_bins(indices, Dim::Event, events));
+  binned.masks().set("mask", makeVariable<bool>(Dims{Dim::X}, Shape{2},
+                                                Values{false, true}));
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(binned);
+  accumulator.add(binned);
+  const auto single = histogram(binned, edges).data();
+  EXPECT_EQ(accumulator.snapshot().data(), single + single);
+}
+
+TEST_F(HistogramAccumulatorTest, failed_add_does_not_modify_result) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  auto other = copy(events);
+  other.setUnit(sc_units::m);
+  EXPECT_THROW(accumulator.add(other), except::UnitError);
+  accumulator.add(events);
+  const auto single = histogram(events, edges).data();
+  EXPECT_EQ(accumulator.snapshot().data(), single + single);
+}
+
+TEST_F(HistogramAccumulatorTest, reset) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  accumulator.reset();
+  EXPECT_EQ(accumulator.snapshot().data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::counts,
+                                 Values{0, 0, 0}, Variances{0, 0, 0}));
+  accumulator.add(events);
+  EXPECT_EQ(accumulator.snapshot(), histogram(events, edges));
+}
+
+TEST_F(HistogramAccumulatorTest, snapshot_is_readonly_and_unchanged_by_add) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  const auto snapshot = accumulator.snapshot();
+  EXPECT_TRUE(snapshot.data().is_readonly());
+  accumulator.add(events);
+  accumulator.add(events);
+  EXPECT_EQ(snapshot, histogram(events, edges));
+}
+
+TEST_F(HistogramAccumulatorTest, snapshot_buffers_are_reused) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  accumulator.add(events);
+  const auto *a = accumulator.snapshot().data().values<double>().data();
+  accumulator.add(events);
+  accumulator.add(events);
+  EXPECT_EQ(accumulator.snapshot().data().values<double>().data(), a);
+}
+
+TEST_F(HistogramAccumulatorTest, snapshots_held_across_adds) {
+  HistogramAccumulator accumulator(edges);
+  const auto single = histogram(events, edges).data();
+  auto expected = copy(single);
+  std::vector<DataArray> snapshots;
+  for (scipp::index i = 0; i < 5; ++i) {
+    accumulator.add(events);
+    // Holding every other snapshot prevents reuse of the back buffer.
+    if (i % 2 == 1)
+      snapshots.push_back(accumulator.snapshot());
+    EXPECT_EQ(accumulator.snapshot().data(), expected);
+    expected += single;
+  }
+}
+
+TEST_F(HistogramAccumulatorTest, batch_modified_after_add) {
+  HistogramAccumulator accumulator(edges);
+  auto batch = copy(events);
+  accumulator.add(batch);
+  // Modifying the previous batch must not affect the accumulated histogram.
+  auto coord = batch.coords()[Dim::X];
+  coord.values<double>()[0] = 3.0;
+  accumulator.add(events);
+  accumulator.add(events);
+  const auto single = histogram(events, edges).data();
+  EXPECT_EQ(accumulator.snapshot().data(), single + single + single);
+}
+
+TEST_F(HistogramAccumulatorTest, unit_mismatch_throws) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  auto other = copy(events);
+  other.setUnit(sc_units::m);
+  EXPECT_THROW(accumulator.add(other), except::UnitError);
+  other = copy(events);
+  other.coords()[Dim::X].setUnit(sc_units::m);
+  EXPECT_THROW(accumulator.add(other), except::UnitError);
+}
+
+TEST_F(HistogramAccumulatorTest, concurrent_add_and_snapshot) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(events);
+  const auto single = histogram(events, edges).data();
+  const auto is_multiple_of_single = [&](const Variable &hist,
+                                         const double count) {
+    for (scipp::index i = 0; i < single.dims().volume(); ++i)
+      if (hist.values<double>()[i] != count * single.values<double>()[i] ||
+          hist.variances<double>()[i] != count * single.variances<double>()[i])
+        return false;
+    return true;
+  };
+  std::thread writer([&]() {
+    for (int i = 0; i < 100; ++i)
+      accumulator.add(events);
+  });
+  for (int i = 0; i < 100; ++i) {
+    // Snapshots never contain partially added batches.
+    const auto hist = accumulator.snapshot().data();
+    const auto count = hist.values<double>()[0] / single.values<double>()[0];
+    EXPECT_TRUE(is_multiple_of_single(hist, count));
+  }
+  writer.join();
+  EXPECT_TRUE(is_multiple_of_single(accumulator.snapshot().data(), 101));
+}
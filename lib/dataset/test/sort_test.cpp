@@ -3,6 +3,7 @@
 #include "test_macros.h"
 #include <gtest/gtest.h>
 
+#include "scipp/dataset/bins.h"
 #include "scipp/dataset/sort.h"
 
 using namespace scipp;
@@ -136,6 +137,14 @@ TEST(SortTest, data_array_1d_descending) {
   EXPECT_EQ(sort(table, Dim::X, SortOrder::Descending), sorted_table);
 }
 
+TEST(SortTest, data_array_empty) {
+  const DataArray empty(
+      makeVariable<double>(Dims{Dim::X}, Shape{0}, sc_units::m),
+      {{Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{0})}});
+  EXPECT_EQ(sort(empty, Dim::X), empty);
+  EXPECT_EQ(sort(empty, Dim::X, SortOrder::Descending), empty);
+}
+
 TEST(SortTest, data_array_bin_edge_coord_throws) {
   Variable data = makeVariable<double>(
       Dims{Dim::Event}, Shape{4}, Values{1, 2, 3, 4}, Variances{1, 3, 2, 4});
@@ -188,3 +197,85 @@ TEST(SortTest, dataset_1d_descending) {
 
   EXPECT_EQ(sort(d, key, SortOrder::Descending), expected);
 }
+
+class SortBinsTest : public ::testing::Test {
+protected:
+  Variable indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 3}, std::pair{3, 3}, std::pair{3, 7}});
+  DataArray buffer{
+      makeVariable<double>(Dims{Dim::Event}, Shape{7}, sc_units::counts,
+                           Values{1, 2, 3, 4, 5, 6, 7},
+                           Variances{1, 2, 3, 4, 5, 6, 7}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::Event}, Shape{7}, sc_units::m,
+                                     Values{3, 1, 2, 5, 4, 5, 1})}},
+      {{"mask", makeVariable<bool>(Dims{Dim::Event}, Shape{7},
+                                   Values{true, false, false, false, true,
+                                          false, false})}}};
+  DataArray binned{make_bins(indices, Dim::Event, buffer),
+                   {{Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{3},
+                                                  Values{1, 2, 3})}}};
+
+  DataArray make_expected(const std::vector<scipp::index> &order) {
+    DataArray expected = copy(buffer);
+    for (scipp::index i = 0; i < scipp::size(order); ++i)
+      copy(buffer.slice({Dim::Event, order[i]}),
+           expected.slice({Dim::Event, i}));
+    auto expected_binned = copy(binned);
+    expected_binned.setData(make_bins(indices, Dim::Event, expected));
+    return expected_binned;
+  }
+};
+
+TEST_F(SortBinsTest, ascending) {
+  EXPECT_EQ(buckets::sort(binned, Dim::X),
+            make_expected({1, 2, 0, 6, 4, 3, 5}));
+}
+
+TEST_F(SortBinsTest, descending_keeps_order_of_equal_keys) {
+  EXPECT_EQ(buckets::sort(binned, Dim::X, SortOrder::Descending),
+            make_expected({0, 2, 1, 3, 5, 4, 6}));
+}
+
+TEST_F(SortBinsTest, string_key) {
+  // Same order as the numeric coord, but sorted using a comparison sort.
+  const auto label = makeVariable<std::string>(
+      Dims{Dim::Event}, Shape{7}, Values{"c", "a", "b", "e", "d", "e", "a"});
+  buffer.coords().set(Dim("label"), label);
+  binned.setData(make_bins(indices, Dim::Event, buffer));
+  EXPECT_EQ(buckets::sort(binned, Dim("label")),
+            make_expected({1, 2, 0, 6, 4, 3, 5}));
+  EXPECT_EQ(buckets::sort(binned, Dim("label"), SortOrder::Descending),
+            make_expected({0, 2, 1, 3, 5, 4, 6}));
+}
+
+TEST_F(SortBinsTest, slice) {
+  const auto slice = binned.slice({Dim::Y, 2, 3});
+  const auto sorted = buckets::sort(slice, Dim::X);
+  EXPECT_EQ(sorted, make_expected({1, 2, 0, 6, 4, 3, 5}).slice({Dim::Y, 2, 3}));
+  EXPECT_EQ(sorted.data().bin_buffer<DataArray>().dims()[Dim::Event], 4);
+}
+
+TEST_F(SortBinsTest, bins_larger_than_parallel_threshold) {
+  const scipp::index size = 200000;
+  auto x = makeVariable<int64_t>(Dims{Dim::Event}, Shape{size});
+  auto values = x.values<int64_t>();
+  for (scipp::index i = 0; i < size; ++i)
+    values[i] = (i * 7919) % 1000;
+  const auto large = make_bins(
+      makeVariable<scipp::index_pair>(
+          Dims{Dim::Y}, Shape{2},
+          Values{std::pair{0, size / 2}, std::pair{size / 2, size}}),
+      Dim::Event, DataArray(copy(x), {{Dim::X, x}}));
+  const auto sorted = buckets::sort(DataArray(large), Dim::X);
+  const auto &[i, dim, buf] = sorted.data().constituents<DataArray>();
+  for (const auto &[begin, end] : i.values<scipp::index_pair>()) {
+    const auto keys = buf.coords()[Dim::X].values<int64_t>().as_span();
+    EXPECT_TRUE(std::is_sorted(keys.begin() + begin, keys.begin() + end));
+  }
+  EXPECT_EQ(buf.data(), buf.coords()[Dim::X]);
+}
+
+TEST_F(SortBinsTest, missing_key_throws) {
+  EXPECT_THROW_DISCARD(buckets::sort(binned, Dim::Y), except::NotFoundError);
+}
@@ -218,14 +218,6 @@ void expect_positional_index(const py::slice &py_slice) {
 template <class T>
 T slice_by_list(const T &obj,
                 const std::tuple<Dim, std::vector<scipp::index>> &index) {
-  const auto make_slice = [](scipp::index p, const scipp::index s) {
-    const auto positive_p = p < 0 ? s + p : p;
-    if (positive_p < 0 || positive_p >= s)
-      throw std::out_of_range("The requested index " + std::to_string(p) +
-                              " is out of range for dimension of length " +
-                              std::to_string(s));
-    return std::tuple{positive_p, positive_p + 1};
-  };
   const auto &[dim, indices] = index;
   const auto size = obj.dims()[dim];
   if (!indices.empty()) {
@@ -235,16 +227,11 @@ T slice_by_list(const T &obj,
       throw_index_error(bad, size);
     }
   }
-  std::vector<scipp::index_pair> ranges;
-  ranges.reserve(indices.size());
-  for (const auto &pos : indices) {
-    const auto [start, stop] = make_slice(pos, size);
-    ranges.emplace_back(static_cast<scipp::index>(start),
-                        static_cast<scipp::index>(stop));
-  }
-  return extract_ranges(makeVariable<scipp::index_pair>(
-                            Dims{dim}, Shape{ranges.size()}, Values(ranges)),
-                        obj, dim);
+  auto positions = makeVariable<int64_t>(Dims{dim}, Shape{indices.size()});
+  std::transform(indices.begin(), indices.end(),
+                 positions.values<int64_t>().begin(),
+                 [size](const scipp::index i) { return i < 0 ? size + i : i; });
+  return extract_indices(positions, obj, dim);
 }
 } // namespace
 
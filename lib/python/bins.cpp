@@ -6,6 +6,7 @@
 #include "scipp/core/except.h"
 #include "scipp/dataset/bin.h"
 #include "scipp/dataset/bins_view.h"
+#include "scipp/dataset/sort.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/shape.h"
@@ -21,6 +22,8 @@ using namespace scipp;
 
 namespace py = pybind11;
 
+SortOrder get_sort_order(const std::string &order);
+
 namespace {
 
 template <class T>
@@ -73,12 +76,14 @@ template <class T> void bind_bins(pybind11::module &m) {
   m.def(
       "_bins_no_validate",
       [](const Variable &begin, const Variable &end, const std::string &dim,
-         const T &data) {
-        return call_make_bins(begin, end, Dim{dim}, T(data), false);
+         const T &data, const bool aligned) {
+        auto out = call_make_bins(begin, end, Dim{dim}, T(data), false);
+        out.set_aligned(aligned);
+        return out;
       },
-      py::arg("begin"), py::arg("end"), py::arg("dim"),
-      py::arg("data")); // do not release GIL since using
-                        // implicit conversions in functor
+      py::arg("begin"), py::arg("end"), py::arg("dim"), py::arg("data"),
+      py::arg("aligned") = true); // do not release GIL since using
+                                  // implicit conversions in functor
 }
 
 template <class T> py::dict bins_constituents(const Variable &var) {
@@ -214,6 +219,31 @@ void init_buckets(py::module &m) {
         return dataset::buckets::append(a, b);
       },
       py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "extend",
+      [](Variable &a, const Variable &b) {
+        return dataset::buckets::extend(a, b);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "extend",
+      [](DataArray &a, const DataArray &b) {
+        return dataset::buckets::extend(a, b);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact",
+      [](Variable &var) { return dataset::buckets::compact(var); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact", [](DataArray &a) { return dataset::buckets::compact(a); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "sort",
+      [](const DataArray &a, const std::string &key, const std::string &order) {
+        return dataset::buckets::sort(a, Dim{key}, get_sort_order(order));
+      },
+      py::call_guard<py::gil_scoped_release>());
   buckets.def(
       "map",
       [](const DataArray &function, const Variable &x, const std::string &dim,
@@ -7,6 +7,7 @@
 
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/histogram.h"
+#include "scipp/dataset/histogram_accumulator.h"
 
 using namespace scipp;
 using namespace scipp::variable;
@@ -30,7 +31,30 @@ template <class T> void bind_histogram(py::module &m) {
       doc.c_str());
 }
 
+void bind_histogram_accumulator(py::module &m) {
+  py::class_<HistogramAccumulator>(m, "HistogramAccumulator", R"(
+    Accumulate the histogram of a stream of event batches.
+
+    Each batch passed to :py:meth:`add` is histogrammed directly into the
+    accumulated result. :py:meth:`snapshot` returns the result as of the last
+    completed :py:meth:`add` or :py:meth:`reset` without waiting for
+    concurrent calls to :py:meth:`add`.)")
+      .def(py::init<const Variable &>(), py::arg("edges"))
+      .def("add", &HistogramAccumulator::add, py::arg("events"),
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Add the histogram of a batch of events. Masks are applied.)")
+      .def("reset", &HistogramAccumulator::reset,
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Set all bins of the accumulated histogram to zero.)")
+      .def("snapshot", &HistogramAccumulator::snapshot,
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Return a read-only copy of the accumulated histogram.)")
+      .def_property_readonly("edges", &HistogramAccumulator::edges,
+                             R"(Bin edges of the histogram.)");
+}
+
 void init_histogram(py::module &m) {
   bind_histogram<DataArray>(m);
   bind_histogram<Dataset>(m);
+  bind_histogram_accumulator(m);
 }
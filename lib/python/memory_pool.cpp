@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/memory_pool.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+void init_memory_pool(py::module &m) {
+  using namespace core::memory_pool;
+  m.def("_memory_pool_enabled", &is_enabled);
+  m.def("_set_memory_pool_enabled", &set_enabled, py::arg("enabled"));
+  m.def("_memory_pool_thread_cache_limit", &thread_cache_limit);
+  m.def("_set_memory_pool_thread_cache_limit", &set_thread_cache_limit,
+        py::arg("bytes"));
+  m.def("_memory_pool_largest_class_buffers", &largest_class_buffers);
+  m.def("_set_memory_pool_largest_class_buffers", &set_largest_class_buffers,
+        py::arg("count"));
+  m.def("_memory_pool_effective_thread_cache_limit",
+        &effective_thread_cache_limit);
+  m.def("_trim_memory_pool", &trim);
+  m.def("_memory_pool_statistics", [] {
+    const auto stats = statistics();
+    py::dict result;
+    result["hits"] = stats.hits;
+    result["misses"] = stats.misses;
+    result["bytes_cached"] = stats.bytes_cached;
+    result["high_water_mark"] = stats.high_water_mark;
+    return result;
+  });
+}
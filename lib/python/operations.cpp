@@ -9,6 +9,7 @@
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/except.h"
 #include "scipp/dataset/sort.h"
+#include "scipp/variable/arithmetic.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/operations.h"
 #include "scipp/variable/slice.h"
@@ -21,7 +22,7 @@ using namespace scipp::dataset;
 
 namespace py = pybind11;
 
-auto get_sort_order(const std::string &order) {
+SortOrder get_sort_order(const std::string &order) {
   if (order == "ascending")
     return SortOrder::Ascending;
   else if (order == "descending")
@@ -143,9 +144,27 @@ void bind_where(py::module &m) {
       py::arg("condition"), py::arg("x"), py::arg("y"));
 }
 
+template <class Op>
+void bind_binary_out(py::module &m, const char *name, Op op) {
+  m.def(
+      name,
+      [op](const Variable &a, const Variable &b, Variable &out) {
+        return op(a, b, out);
+      },
+      py::arg("a"), py::arg("b"), py::arg("out"), py::keep_alive<0, 3>(),
+      py::call_guard<py::gil_scoped_release>());
+}
+
 void init_operations(py::module &m) {
   bind_dot<Variable>(m);
 
+  using binary_out = Variable &(*)(const Variable &, const Variable &,
+                                   Variable &);
+  bind_binary_out(m, "add", static_cast<binary_out>(&variable::add));
+  bind_binary_out(m, "subtract", static_cast<binary_out>(&variable::subtract));
+  bind_binary_out(m, "multiply", static_cast<binary_out>(&variable::multiply));
+  bind_binary_out(m, "divide", static_cast<binary_out>(&variable::divide));
+
   bind_sort<Variable>(m);
   bind_sort<DataArray>(m);
   bind_sort<Dataset>(m);
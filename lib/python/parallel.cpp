@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "scipp/core/numa.h"
+#include "scipp/core/parallel.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+namespace {
+/// Wrapper allowing Python to end the lifetime of a ThreadLimit explicitly.
+class ThreadLimit {
+public:
+  explicit ThreadLimit(const scipp::index max_threads) {
+    if (max_threads < 1)
+      throw std::invalid_argument(
+          "The number of threads must be at least 1, got " +
+          std::to_string(max_threads) + '.');
+    m_limit.emplace(max_threads);
+  }
+  void release() { m_limit.reset(); }
+
+private:
+  std::optional<core::parallel::ThreadLimit> m_limit;
+};
+
+std::string to_string(const core::numa::Policy policy) {
+  switch (policy) {
+  case core::numa::Policy::FirstTouch:
+    return "first_touch";
+  case core::numa::Policy::Interleave:
+    return "interleave";
+  default:
+    return "default";
+  }
+}
+
+core::numa::Policy to_numa_policy(const std::string &policy) {
+  if (policy == "default")
+    return core::numa::Policy::Default;
+  if (policy == "first_touch")
+    return core::numa::Policy::FirstTouch;
+  if (policy == "interleave")
+    return core::numa::Policy::Interleave;
+  throw std::invalid_argument(
+      "Unknown NUMA policy '" + policy +
+      "', expected 'default', 'first_touch', or 'interleave'.");
+}
+} // namespace
+
+void init_parallel(py::module &m) {
+  m.def("max_threads", &core::parallel::max_concurrency);
+  py::class_<ThreadLimit>(m, "_ThreadLimit")
+      .def(py::init<scipp::index>(), py::arg("max_threads"))
+      .def("release", &ThreadLimit::release);
+  m.def("_numa_policy", [] { return to_string(core::numa::policy()); });
+  m.def(
+      "_set_numa_policy",
+      [](const std::string &policy) {
+        core::numa::set_policy(to_numa_policy(policy));
+      },
+      py::arg("policy"));
+  m.def("_numa_node_count", &core::numa::node_count);
+}
@@ -18,7 +18,9 @@ void init_exceptions(py::module &);
 void init_groupby(py::module &);
 void init_geometry(py::module &);
 void init_histogram(py::module &);
+void init_memory_pool(py::module &);
 void init_operations(py::module &);
+void init_parallel(py::module &);
 void init_shape(py::module &);
 void init_trigonometry(py::module &);
 void init_unary(py::module &);
@@ -54,6 +56,8 @@ void init_core(py::module &m) {
   init_groupby(core);
   init_comparison(core);
   init_operations(core);
+  init_memory_pool(core);
+  init_parallel(core);
   init_shape(core);
   init_geometry(core);
   init_histogram(core);
@@ -4,37 +4,209 @@
 /// @author Simon Heybrock
 #include "pybind11.h"
 
+#include <algorithm>
+
+#include "scipp/core/except.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/variable_factory.h"
+
+#include "dtype.h"
 
 using namespace scipp;
 
 namespace py = pybind11;
 
-template <class T, class... Ts> void bind_transform(py::module &m) {
-  m.def("transform", [](py::object const &kernel,
-                        const std::conditional_t<true, Variable, Ts> &...vars) {
-    auto fptr_address = kernel.attr("address").cast<intptr_t>();
-    auto fptr = reinterpret_cast<T (*)(Ts...)>(fptr_address);
-    auto name = kernel.attr("name").cast<std::string>();
-    return variable::transform<std::tuple<Ts...>>(
-        vars...,
-        overloaded{core::transform_flags::expect_no_variance_arg<0>,
-                   core::transform_flags::expect_no_variance_arg<1>,
-                   core::transform_flags::expect_no_variance_arg<2>,
-                   core::transform_flags::expect_no_variance_arg<3>,
-                   [&kernel](const sc_units::Unit &u, const auto &...us) {
-                     py::gil_scoped_acquire acquire;
-                     return py::cast<sc_units::Unit>(
-                         kernel.attr("unit_func")(u, us...));
-                   },
-                   [fptr](const auto &...args) { return fptr(args...); }},
-        name);
-  });
+namespace {
+/// Kernel processing an inner loop of transform at once, similar to the inner
+/// loops of NumPy ufuncs. It is called as `kernel(n, data, strides)` where
+/// `data` holds pointers to the first element of all outputs followed by all
+/// inputs, and `strides` their strides in units of elements. Operands with
+/// variances contribute two entries, values followed by variances, sharing a
+/// stride. Outputs have variances if any input has variances and the output
+/// dtype is floating-point. Kernels must set the attribute `variances` to
+/// `True` to accept inputs with variances.
+using batch_kernel = void (*)(int64_t, void *const *, const int64_t *);
+
+template <class T>
+constexpr bool has_variances =
+    variable::detail::is_ValueAndVariancePointers_v<std::decay_t<T>>;
+
+template <class T> void *void_ptr(T *ptr) {
+  return const_cast<void *>(static_cast<const void *>(ptr));
+}
+
+/// Batch operator of transform, calling the kernel with the layout described
+/// above.
+struct CallBatchKernel {
+  batch_kernel fptr;
+
+  template <class... Ptrs>
+  void operator()(const scipp::index n,
+                  const std::span<const scipp::index> strides,
+                  const Ptrs... ptrs) const {
+    constexpr auto size = ((has_variances<Ptrs> ? 2 : 1) + ...);
+    std::array<void *, size> data;
+    std::array<int64_t, size> stream_strides;
+    size_t stream = 0;
+    size_t operand = 0;
+    const auto add = [&](const auto ptr) {
+      if constexpr (has_variances<decltype(ptr)>) {
+        data[stream] = void_ptr(ptr.values);
+        stream_strides[stream++] = strides[operand];
+        data[stream] = void_ptr(ptr.variances);
+      } else {
+        data[stream] = void_ptr(ptr);
+      }
+      stream_strides[stream++] = strides[operand++];
+    };
+    (add(ptrs), ...);
+    fptr(n, data.data(), stream_strides.data());
+  }
+};
+
+auto get_kernel(py::object const &kernel) {
+  return CallBatchKernel{reinterpret_cast<batch_kernel>(
+      kernel.attr("address").cast<intptr_t>())};
+}
+
+template <class Out, class... Ts>
+Variable transform_batch(py::object const &kernel, const Ts &...vars) {
+  const auto name = kernel.attr("name").cast<std::string>();
+  return variable::transform<std::tuple<typename Ts::element_type...>>(
+      vars.var...,
+      overloaded{
+          core::transform_flags::batch,
+          [](const typename Ts::element_type &...) -> Out { return Out{}; },
+          [&kernel](const sc_units::Unit &u, const auto &...us) {
+            py::gil_scoped_acquire acquire;
+            return py::cast<sc_units::Unit>(kernel.attr("unit_func")(u, us...));
+          },
+          get_kernel(kernel)},
+      name);
+}
+
+template <class T, size_t> struct repeat {
+  using type = T;
+};
+
+/// Transform with `NOut` outputs.
+///
+/// Outputs are created upfront. The first is transformed in-place, the others
+/// are passed as further operands of the in-place transform. They are written
+/// by the kernel only, i.e., this is safe since they are not shared.
+template <size_t NOut, class Out, class... Ts>
+std::vector<Variable> transform_batch_outputs(py::object const &kernel,
+                                              const Ts &...vars) {
+  if ((is_bins(vars.var) || ...))
+    throw except::BinnedDataError(
+        "Transforms with multiple outputs do not support binned data.");
+  const auto name = kernel.attr("name").cast<std::string>();
+  const auto units = py::tuple(kernel.attr("unit_func")(vars.var.unit()...));
+  if (units.size() != NOut)
+    throw except::TypeError("unit_func must return one unit per output, got " +
+                            std::to_string(units.size()) + " for " +
+                            std::to_string(NOut) + " outputs.");
+  const auto dims = merge(vars.var.dims()...);
+  const bool variances =
+      core::canHaveVariances<Out>() && (vars.var.has_variances() || ...);
+  std::vector<Variable> outs;
+  for (size_t i = 0; i < NOut; ++i)
+    outs.push_back(variable::empty(dims, py::cast<sc_units::Unit>(units[i]),
+                                   dtype<Out>, variances));
+  const auto op = overloaded{
+      core::transform_flags::batch,
+      [](Out &, const auto &...) {}, [](sc_units::Unit &, const auto &...) {},
+      get_kernel(kernel)};
+  [&]<size_t... I>(std::index_sequence<I...>) {
+    variable::transform_in_place<std::tuple<
+        Out, typename repeat<Out, I>::type..., typename Ts::element_type...>>(
+        outs[0], outs[I + 1]..., vars.var..., op, name);
+  }(std::make_index_sequence<NOut - 1>{});
+  return outs;
+}
+
+template <class T> struct Typed {
+  using element_type = T;
+  const Variable &var;
+};
+
+template <class T, class Out, class... Vars>
+py::object transform_batch_typed(py::object const &kernel,
+                                 const scipp::index nout, const Vars &...vars) {
+  // In-place transform, used for multiple outputs, supports at most four
+  // operands.
+  constexpr scipp::index max_nout = 4 - sizeof...(Vars);
+  if (nout == 1)
+    return py::cast(transform_batch<Out>(kernel, Typed<T>{vars}...));
+  if constexpr (max_nout >= 2)
+    if (nout == 2)
+      return py::cast(
+          transform_batch_outputs<2, Out>(kernel, Typed<T>{vars}...));
+  if constexpr (max_nout >= 3)
+    if (nout == 3)
+      return py::cast(
+          transform_batch_outputs<3, Out>(kernel, Typed<T>{vars}...));
+  throw except::TypeError(
+      "Unsupported number of outputs " + std::to_string(nout) + " for " +
+      std::to_string(sizeof...(Vars)) + " inputs. At most " +
+      std::to_string(std::max(scipp::index{1}, max_nout)) +
+      " outputs are supported.");
+}
+
+template <class T, class... Vars>
+py::object transform_batch_out(py::object const &kernel, const DType out,
+                               const scipp::index nout, const Vars &...vars) {
+  if (out == dtype<T>)
+    return transform_batch_typed<T, T>(kernel, nout, vars...);
+  if constexpr (!std::is_same_v<T, double>)
+    if (out == dtype<double>)
+      return transform_batch_typed<T, double>(kernel, nout, vars...);
+  if constexpr (!std::is_same_v<T, bool>)
+    if (out == dtype<bool>)
+      return transform_batch_typed<T, bool>(kernel, nout, vars...);
+  throw except::TypeError("Unsupported output dtype " + to_string(out) +
+                          " for inputs with dtype " + to_string(dtype<T>) +
+                          ". The output dtype must be the input dtype, "
+                          "float64, or bool.");
+}
+
+template <class... Vars> void bind_transform_batch(py::module &m) {
+  m.def(
+      "transform_batch",
+      [](py::object const &kernel, const py::object &out_dtype,
+         const scipp::index nout, const Vars &...vars) {
+        const auto out = scipp_dtype(out_dtype);
+        // The memory layout passed to the kernel depends on which operands
+        // have variances, so kernels must opt in to support variances.
+        if (!(py::hasattr(kernel, "variances") &&
+              kernel.attr("variances").cast<bool>()) &&
+            (vars.has_variances() || ...))
+          throw except::VariancesError(
+              "Variances are not supported by this kernel.");
+        const auto type = std::get<0>(std::tie(vars...)).dtype();
+        if (((vars.dtype() != type) || ...))
+          throw except::TypeError(
+              "All inputs of a transform must have the same dtype.");
+        if (type == dtype<double>)
+          return transform_batch_out<double>(kernel, out, nout, vars...);
+        if (type == dtype<float>)
+          return transform_batch_out<float>(kernel, out, nout, vars...);
+        if (type == dtype<int64_t>)
+          return transform_batch_out<int64_t>(kernel, out, nout, vars...);
+        if (type == dtype<int32_t>)
+          return transform_batch_out<int32_t>(kernel, out, nout, vars...);
+        if (type == dtype<bool>)
+          return transform_batch_out<bool>(kernel, out, nout, vars...);
+        throw except::TypeError("Unsupported input dtype " + to_string(type) +
+                                " in transform.");
+      });
 }
+} // namespace
 
 void init_transform(py::module &m) {
-  bind_transform<double, double>(m);
-  bind_transform<double, double, double>(m);
-  bind_transform<double, double, double, double>(m);
-  bind_transform<double, double, double, double, double>(m);
+  bind_transform_batch<Variable>(m);
+  bind_transform_batch<Variable, Variable>(m);
+  bind_transform_batch<Variable, Variable, Variable>(m);
+  bind_transform_batch<Variable, Variable, Variable, Variable>(m);
 }
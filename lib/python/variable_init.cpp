@@ -3,6 +3,9 @@
 /// @file
 /// @author Jan-Lukas Wynen
 
+#include <mutex>
+#include <vector>
+
 #include "pybind11.h"
 
 #include "scipp/core/dtype.h"
@@ -183,12 +186,99 @@ python::PyObject extract_scalar<python::PyObject>(const py::object &obj,
   return obj;
 }
 
+/// References to Python objects dropped by threads not holding the GIL.
+struct PendingReleases {
+  std::mutex mutex;
+  std::vector<const py::object *> objects;
+  bool scheduled{false};
+};
+
+PendingReleases &pending_releases() {
+  // Leaked intentionally, pending calls may run during interpreter shutdown.
+  static auto *pending = new PendingReleases;
+  return *pending;
+}
+
+/// Release all pending references. Must be called while holding the GIL.
+int release_pending(void * = nullptr) {
+  std::vector<const py::object *> objects;
+  {
+    auto &pending = pending_releases();
+    std::lock_guard lock(pending.mutex);
+    objects.swap(pending.objects);
+    pending.scheduled = false;
+  }
+  for (const auto *obj : objects)
+    delete obj;
+  return 0;
+}
+
+/// Release a reference to a Python object.
+///
+/// The last reference to a variable, and thus to the object, may be dropped
+/// by a thread that does not hold the GIL, e.g., a TBB worker or code that
+/// released the GIL. Acquiring the GIL there can deadlock if the thread
+/// holding the GIL waits for that thread. Instead, the release is deferred to
+/// the main interpreter thread via Py_AddPendingCall, which does not require
+/// the GIL.
+void release(const py::object *obj) {
+  if (PyGILState_Check()) {
+    delete obj;
+    return;
+  }
+  auto &pending = pending_releases();
+  std::lock_guard lock(pending.mutex);
+  pending.objects.push_back(obj);
+  // If scheduling fails, e.g., since the queue of pending calls is full, the
+  // next release retries.
+  if (!pending.scheduled)
+    pending.scheduled = Py_AddPendingCall(release_pending, nullptr) == 0;
+}
+
+/// Return a reference to a Python object that keeps it alive.
+std::shared_ptr<const void> keep_alive(const py::object &obj) {
+  release_pending();
+  return std::shared_ptr<const void>(new py::object(obj), release);
+}
+
+/// Return an element_array referencing the buffer of `source`, or std::nullopt
+/// if the buffer cannot be used without conversion or copy.
+///
+/// The buffer must be writeable, C-contiguous, aligned, and have the exact dtype
+/// of T in native byte order. Read-only buffers are not adopted since scipp
+/// assumes that it may write to the data of any variable that is not itself
+/// read-only.
+template <class T>
+std::optional<element_array<T>> adopt_array(const Dimensions &dims,
+                                            const py::object &source) {
+  if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float> ||
+                std::is_same_v<T, int64_t> || std::is_same_v<T, int32_t> ||
+                std::is_same_v<T, bool>) {
+    if (!py::array_t<T, py::array::c_style>::check_(source))
+      return std::nullopt;
+    const auto array = py::reinterpret_borrow<py::array>(source);
+    if (!(array.flags() & py::detail::npy_api::NPY_ARRAY_ALIGNED_) ||
+        !array.writeable() || array.size() != dims.volume())
+      return std::nullopt;
+    return element_array<T>(static_cast<T *>(const_cast<void *>(array.data())),
+                            dims.volume(), keep_alive(array));
+  } else {
+    static_cast<void>(dims);
+    static_cast<void>(source);
+    return std::nullopt;
+  }
+}
+
 template <class T>
 auto make_element_array(const Dimensions &dims, const py::object &source,
-                        const sc_units::Unit unit) {
+                        const sc_units::Unit unit, const bool copy = true) {
   if (source.is_none()) {
     return element_array<T>();
-  } else if (dims.ndim() == 0) {
+  } else if (!copy && dims.ndim() != 0) {
+    if (auto array = adopt_array<T>(dims, source))
+      return std::move(*array);
+  }
+  if (dims.ndim() == 0) {
     return element_array<T>(1, extract_scalar<T>(source, unit));
   } else {
     element_array<T> array(dims.volume(), core::init_for_overwrite);
@@ -199,17 +289,18 @@ auto make_element_array(const Dimensions &dims, const py::object &source,
 
 template <class T> struct MakeVariable {
   static Variable apply(const Dimensions &dims, const py::object &values,
-                        const py::object &variances,
-                        const sc_units::Unit unit) {
+                        const py::object &variances, const sc_units::Unit unit,
+                        const bool copy) {
     const auto [values_unit, final_unit] = common_unit<T>(values, unit);
     auto values_array =
-        Values(make_element_array<T>(dims, values, values_unit));
-    auto variable = variances.is_none()
-                        ? makeVariable<T>(dims, std::move(values_array))
-                        // cppcheck-suppress accessMoved  # False-positive.
-                        : makeVariable<T>(dims, std::move(values_array),
-                                          Variances(make_element_array<T>(
-                                              dims, variances, values_unit)));
+        Values(make_element_array<T>(dims, values, values_unit, copy));
+    auto variable =
+        variances.is_none()
+            ? makeVariable<T>(dims, std::move(values_array))
+            // cppcheck-suppress accessMoved  # False-positive.
+            : makeVariable<T>(dims, std::move(values_array),
+                              Variances(make_element_array<T>(
+                                  dims, variances, values_unit, copy)));
     variable.setUnit(values_unit);
     return to_unit(variable, final_unit, CopyPolicy::TryAvoid);
   }
@@ -217,8 +308,8 @@ template <class T> struct MakeVariable {
 
 Variable make_variable(const py::object &dim_labels, const py::object &values,
                        const py::object &variances,
-                       const std::optional<sc_units::Unit> &unit_,
-                       DType dtype) {
+                       const std::optional<sc_units::Unit> &unit_, DType dtype,
+                       const bool copy) {
   const auto converted_values = parse_data_sequence(dim_labels, values);
   const auto converted_variances = parse_data_sequence(dim_labels, variances);
   dtype = common_dtype(converted_values, converted_variances, dtype);
@@ -230,8 +321,8 @@ Variable make_variable(const py::object &dim_labels, const py::object &values,
                          DataArray, Dataset,
                          python::PyObject>::apply<MakeVariable>(dtype, dims,
                                                                 values,
-                                                                variances,
-                                                                unit);
+                                                                variances, unit,
+                                                                copy);
 }
 
 template <int N> Dimensions pad_structure_dimensions(Dimensions dims) {
@@ -274,7 +365,8 @@ void bind_init(py::class_<Variable> &cls) {
   cls.def(
       py::init([](const py::object &dim_labels, const py::object &values,
                   const py::object &variances, const ProtoUnit unit,
-                  const py::object &dtype, const bool aligned) {
+                  const py::object &dtype, const bool aligned,
+                  const bool copy) {
         if (values.is_none() && variances.is_none()) {
           throw std::invalid_argument(
               "At least one argument of 'values' and 'variances' is required.");
@@ -301,7 +393,7 @@ void bind_init(py::class_<Variable> &cls) {
                 dim_labels, values, variances, c_actual_unit);
 
           return make_variable(dim_labels, values, variances, c_actual_unit,
-                               c_scipp_dtype);
+                               c_scipp_dtype, copy);
         }();
 
         var.set_aligned(aligned);
@@ -310,6 +402,7 @@ void bind_init(py::class_<Variable> &cls) {
       py::kw_only(), py::arg("dims"), py::arg("values") = py::none(),
       py::arg("variances") = py::none(), py::arg("unit") = DefaultUnit{},
       py::arg("dtype") = py::none(), py::arg("aligned") = true,
+      py::arg("copy") = true,
       R"raw(
 Initialize a variable with values and/or variances.
 
@@ -339,6 +432,12 @@ dtype:
    possible.
 aligned:
    Initial value for the alignment flag.
+copy:
+   If ``False``, NumPy arrays for ``values`` and ``variances`` are used without
+   copying their data if possible. This requires C-contiguous, aligned arrays
+   with the exact dtype of the variable and no unit conversion. The variable
+   then shares memory with the array and keeps it alive. Read-only arrays and
+   other inputs are copied.
 
 Examples
 --------
@@ -4,6 +4,7 @@
 #include "scipp/core/dtype.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arithmetic.h"
+#include "scipp/core/except.h"
 #include "scipp/core/spatial_transforms.h"
 #include "scipp/variable/astype.h"
 #include "scipp/variable/pow.h"
@@ -33,8 +34,59 @@ bool correlated(const Variable &a, const Variable &b) {
          variableFactory().has_variances(b) && a.is_same(b);
 }
 
+/// Compute `op(a, b)` into `out` by copying `a` into `out` and applying the
+/// in-place `op_equals` with `b`.
+template <class Op, class OpEquals>
+Variable &binary_into(const Variable &a, const Variable &b, Variable &out,
+                      Op op, OpEquals op_equals) {
+  const auto dims = merge(a.dims(), b.dims());
+  if (out.dims().ndim() != dims.ndim() || !out.dims().includes(dims))
+    throw except::DimensionError("Expected output with dimensions " +
+                                 to_string(dims) + " in any order, got " +
+                                 to_string(out.dims()) + '.');
+  const auto &factory = variableFactory();
+  if (factory.has_variances(out) !=
+      (factory.has_variances(a) || factory.has_variances(b)))
+    throw except::VariancesError(factory.has_variances(out)
+                                     ? "Expected output without variances."
+                                     : "Expected output with variances.");
+  // Correlations are only handled by the allocating operators, and the copy
+  // of `a` cannot add variances.
+  if (correlated(a, b) ||
+      (factory.has_variances(out) && !factory.has_variances(a)))
+    return copy(astype(op(a, b), out.dtype(), CopyPolicy::TryAvoid), out);
+  // `out` is overwritten with `a` before `b` is read.
+  const auto rhs = out.data().overlaps(out, b) ? copy(b) : b;
+  copy(astype(a, out.dtype(), CopyPolicy::TryAvoid), out);
+  return op_equals(out, rhs);
+}
+
 } // namespace
 
+Variable &add(const Variable &a, const Variable &b, Variable &out) {
+  return binary_into(
+      a, b, out, [](const auto &x, const auto &y) { return x + y; },
+      [](Variable &x, const Variable &y) -> Variable & { return x += y; });
+}
+
+Variable &subtract(const Variable &a, const Variable &b, Variable &out) {
+  return binary_into(
+      a, b, out, [](const auto &x, const auto &y) { return x - y; },
+      [](Variable &x, const Variable &y) -> Variable & { return x -= y; });
+}
+
+Variable &multiply(const Variable &a, const Variable &b, Variable &out) {
+  return binary_into(
+      a, b, out, [](const auto &x, const auto &y) { return x * y; },
+      [](Variable &x, const Variable &y) -> Variable & { return x *= y; });
+}
+
+Variable &divide(const Variable &a, const Variable &b, Variable &out) {
+  return binary_into(
+      a, b, out, [](const auto &x, const auto &y) { return x / y; },
+      [](Variable &x, const Variable &y) -> Variable & { return x /= y; });
+}
+
 Variable operator+(const Variable &a, const Variable &b) {
   if (correlated(a, b))
     return a * make_factor(a, 2.0);
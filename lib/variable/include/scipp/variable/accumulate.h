@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include "scipp/core/partial_reduce.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_factory.h"
@@ -11,6 +12,18 @@
 namespace scipp::variable {
 
 namespace detail {
+/// Number of input elements processed by a single task in do_accumulate. This
+/// corresponds to 1 MiB of doubles, i.e., tiles fit into the L2 cache of
+/// current CPUs while keeping the overhead per task negligible.
+constexpr scipp::index accumulate_tile_size = 131072;
+
+/// Return the slice of `var` obtained by applying all `slices` in order.
+inline Variable slice_all(Variable var, const std::span<const Slice> slices) {
+  for (const auto &slice : slices)
+    var = var.slice(slice);
+  return var;
+}
+
 template <class... Ts, class Op, class Var, class... Other>
 static void do_accumulate(const std::tuple<Ts...> &types, Op op,
                           const std::string_view &name, Var &&var,
@@ -27,7 +40,8 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       (sizeof...(other) != 1 && var.dims().ndim() == 0))
     return in_place<false>::transform_data(types, op, name, var, other...);
 
-  const auto reduce_chunk = [&](auto &&out, const Slice &slice) {
+  const auto reduce_chunk = [&](auto &&out,
+                                const std::span<const Slice> slices) {
     // A typical cache line has 64 Byte, which would fit, e.g., 8 doubles. If
     // multiple threads write to different elements in the same cache lines we
     // have "false sharing", with a severe negative performance impact. 128 is a
@@ -38,24 +52,52 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
     auto tmp = avoid_false_sharing ? copy(out) : out;
     [&](const auto &...args) { // force slices to const, avoid readonly issues
       in_place<false>::transform_data(types, op, name, tmp, args...);
-    }(other.slice(slice)...);
+    }(slice_all(other, slices)...);
     if (avoid_false_sharing)
       copy(tmp, out);
   };
 
-  // TODO The parallelism could be improved for cases where the output has more
-  // than one dimension, e.g., by flattening the output's dims in all inputs.
-  // However, it is nontrivial to detect whether calling `flatten` on `other` is
-  // possible without copies so this is not implemented at this point.
+  // Parallelize over the flattened dims of the output. Since all dims of the
+  // output are also dims of `other`, a contiguous range of the flattened index
+  // can be processed as a sequence of slices of the innermost partitioned dim.
+  // Only as many outer dims are partitioned as required to obtain tiles that
+  // fit into cache, to keep memory access of each task contiguous.
   const auto accumulate_parallel = [&]() {
-    const auto dim = *var.dims().begin();
+    const auto &dims = var.dims();
+    const auto volume = std::max({other.dims().volume()...});
+    if (dims.volume() == 0)
+      return;
+    scipp::index ndim_split = 0;
+    scipp::index count = 1;
+    while (ndim_split < dims.ndim() &&
+           (ndim_split == 0 || volume / count > accumulate_tile_size))
+      count *= dims.size(ndim_split++);
+    const auto inner = ndim_split - 1;
+    // The work per bin of binned input is unknown, use the default grainsize.
+    const auto grainsize =
+        binned_input ? -1
+                     : std::max(scipp::index(1),
+                                accumulate_tile_size / (volume / count));
     const auto reduce = [&](const auto &range) {
-      const Slice slice(dim, range.begin(), range.end());
-      reduce_chunk(var.slice(slice), slice);
+      std::vector<Slice> slices(ndim_split);
+      for (scipp::index i = range.begin(); i < range.end();) {
+        scipp::index end = i;
+        for (scipp::index d = inner, rem = i; d >= 0; --d) {
+          const auto pos = rem % dims.size(d);
+          rem /= dims.size(d);
+          if (d == inner) {
+            end = std::min(range.end(), i + dims.size(d) - pos);
+            slices[d] = Slice(dims.label(d), pos, pos + end - i);
+          } else {
+            slices[d] = Slice(dims.label(d), pos);
+          }
+        }
+        reduce_chunk(slice_all(var, slices), slices);
+        i = end;
+      }
     };
-    const auto size = var.dims()[dim];
-    core::parallel::parallel_for(core::parallel::blocked_range(0, size),
-                                 reduce);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, count, grainsize), reduce);
   };
   if constexpr (sizeof...(other) == 1) {
     const bool reduce_outer =
@@ -73,7 +115,14 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       // speedup in many cases.
       const auto outer_dim = (*other.dims().begin(), ...);
       const auto outer_size = (other.dims()[outer_dim], ...);
-      const auto nchunk = std::min(scipp::index(24), outer_size);
+      // The chunk count depends only on the sizes, so results do not depend
+      // on the number of threads the chunks are scheduled on. Each chunk holds
+      // a copy of the output, limiting it to `outer_size` bounds the memory of
+      // the copies by the input size.
+      const auto nchunk = std::clamp(
+          (other.dims().volume(), ...) / small_input, scipp::index{1},
+          std::max(scipp::index{1},
+                   std::min(outer_size, core::partial_reduce::max_chunks)));
       const auto chunk_size = (outer_size + nchunk - 1) / nchunk;
       // The threading approach in used here is possible only under the
       // assumption that op(var, broadcast(var, ...)) leaves var unchanged. This
@@ -95,12 +144,31 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
         for (scipp::index i = range.begin(); i < range.end(); ++i) {
           const Slice slice(outer_dim, std::min(i * chunk_size, outer_size),
                             std::min((i + 1) * chunk_size, outer_size));
-          reduce_chunk(v.slice({Dim::InternalAccumulate, i}), slice);
+          reduce_chunk(v.slice({Dim::InternalAccumulate, i}),
+                       std::span(&slice, 1));
         }
       };
       core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
                                    reduce);
-      in_place<false>::transform_data(types, op, name, var, v);
+      // Combine partial results as a binary tree in a fixed order. The result
+      // does not depend on scheduling and for floating-point sums the rounding
+      // error grows only logarithmically with the number of chunks.
+      for (scipp::index step = 1; step < nchunk; step *= 2) {
+        const auto combine = [&](const auto &range) {
+          for (scipp::index i = range.begin(); i < range.end(); ++i) {
+            auto out = v.slice({Dim::InternalAccumulate, 2 * step * i});
+            const auto in =
+                v.slice({Dim::InternalAccumulate, 2 * step * i + step});
+            in_place<false>::transform_data(types, op, name, out, in);
+          }
+        };
+        core::parallel::parallel_for(
+            core::parallel::blocked_range(0, (nchunk + step - 1) / (2 * step),
+                                          1),
+            combine);
+      }
+      in_place<false>::transform_data(types, op, name, var,
+                                      v.slice({Dim::InternalAccumulate, 0}));
     } else {
       accumulate_parallel();
     }
@@ -19,6 +19,21 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable operator/(const Variable &a,
                                                        const Variable &b);
 
+/// Arithmetic writing into the preallocated `out`.
+///
+/// `out` must have the dims of the broadcast of `a` and `b`, in any order, and
+/// have variances if and only if an input has. The operation is computed in
+/// the dtype of `out`. Its unit is set by the operation. `out` may alias `a`
+/// or `b`.
+SCIPP_VARIABLE_EXPORT Variable &add(const Variable &a, const Variable &b,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &subtract(const Variable &a, const Variable &b,
+                                         Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &multiply(const Variable &a, const Variable &b,
+                                         Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &divide(const Variable &a, const Variable &b,
+                                       Variable &out);
+
 SCIPP_VARIABLE_EXPORT Variable &operator+=(Variable &a, const Variable &b);
 SCIPP_VARIABLE_EXPORT Variable &operator-=(Variable &a, const Variable &b);
 SCIPP_VARIABLE_EXPORT Variable &operator*=(Variable &a, const Variable &b);
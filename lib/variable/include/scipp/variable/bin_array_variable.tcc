@@ -84,6 +84,12 @@ public:
     return make_bins_no_validate(zip(begin, end), dim,
                                  resize_default_init(buf, dim, size));
   }
+  [[nodiscard]] Variable
+  with_bin_indices(const Variable &prototype,
+                   const Variable &indices) const override {
+    const auto &[_, dim, buf] = prototype.constituents<T>();
+    return make_bins_no_validate(indices, dim, buf);
+  }
 };
 
 template <class T> class BinVariableMaker : public BinVariableMakerCommon<T> {
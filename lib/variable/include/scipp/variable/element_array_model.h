@@ -4,9 +4,12 @@
 /// @author Simon Heybrock
 #pragma once
 #include <optional>
+#include <type_traits>
+#include <vector>
 
 #include "scipp/common/initialization.h"
 #include "scipp/common/numeric.h"
+#include "scipp/core/blocked_copy.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element_array_view.h"
@@ -81,6 +84,7 @@ public:
 
   bool equals(const Variable &a, const Variable &b) const override;
   bool equals_nan(const Variable &a, const Variable &b) const override;
+  bool overlaps(const Variable &a, const Variable &b) const override;
   void copy(const Variable &src, Variable &dest) const override;
   void copy(const Variable &src, Variable &&dest) const override;
   void assign(const VariableConcept &other) override;
@@ -134,14 +138,54 @@ private:
 namespace {
 template <class T> auto copy(const T &x) { return x; }
 constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
+
+/// Copies with fewer elements use transform, even if transposing.
+constexpr scipp::index min_blocked_copy_volume = 4096;
+
+/// Copy using core::blocked_copy if `src` and `dest` have the same dims, in
+/// any order, but the layouts require a transposition. Returns false if not
+/// applicable.
+template <class T>
+bool try_blocked_copy(const Variable &src, Variable &dest) {
+  if constexpr (!std::is_trivially_copyable_v<T>) {
+    return false;
+  } else {
+    const auto &dims = dest.dims();
+    if (src.dtype() != dest.dtype() || src.dims().ndim() != dims.ndim() ||
+        !dims.includes(src.dims()) ||
+        src.has_variances() != dest.has_variances() ||
+        dims.volume() < min_blocked_copy_volume ||
+        src.data().overlaps(src, dest))
+      return false;
+    // Strides of `src` in the dim order of `dest`.
+    std::vector<scipp::index> src_strides;
+    for (const auto &dim : dims.labels())
+      src_strides.push_back(src.strides()[src.dims().index(dim)]);
+    if (!core::is_transposing_copy(dims.shape(), src_strides, dest.strides()))
+      return false;
+    variableFactory().expect_can_set_elem_unit(dest, src.unit());
+    const auto copy_array = [&](const auto &from, auto &&to) {
+      core::blocked_copy(from.data(), to.data(), dims.shape(), src_strides,
+                         dest.strides());
+    };
+    copy_array(src.values<T>(), dest.values<T>());
+    if (src.has_variances())
+      copy_array(src.variances<T>(), dest.variances<T>());
+    variableFactory().set_elem_unit(dest, src.unit());
+    return true;
+  }
+}
 } // namespace
 
 /// Helper for implementing Variable(View) copy operations.
 ///
 /// This method is using virtual dispatch as a trick to obtain T, such that
-/// transform can be called with any T.
+/// transform can be called with any T. Large copies between transposed
+/// layouts use a cache-blocked kernel instead of transform.
 template <class T>
 void ElementArrayModel<T>::copy(const Variable &src, Variable &dest) const {
+  if (try_blocked_copy<T>(src, dest))
+    return;
   transform_in_place<T>(
       dest, src,
       overloaded{core::transform_flags::expect_in_variance_if_out_variance,
@@ -2,6 +2,9 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <functional>
+
+#include "scipp/common/index_composition.h"
 #include "scipp/variable/element_array_model.h"
 #include "scipp/variable/variable.tcc"
 
@@ -120,6 +123,45 @@ bool ElementArrayModel<T>::equals_nan(const Variable &a,
           equals_nan_impl(a.variances<T>(), b.variances<T>()));
 }
 
+namespace {
+/// Return true if the elements of `a` and `b` partially overlap in memory.
+///
+/// Unlike ElementArrayView::overlaps this compares addresses, since distinct
+/// arrays may share memory, e.g., if adopted from NumPy.
+template <class T>
+bool views_overlap(const ElementArrayView<const T> &a,
+                   const ElementArrayView<const T> &b) {
+  if (a.buffer() == b.buffer())
+    return a.overlaps(b);
+  if (a.size() == 0 || b.size() == 0)
+    return false;
+  const auto range = [](const auto &view) {
+    const auto [begin, end] =
+        memory_bounds(view.dims().shape().begin(), view.dims().shape().end(),
+                      view.strides().begin());
+    const auto *base = view.buffer() + view.offset();
+    return std::pair{base + begin, base + end};
+  };
+  const auto [a_begin, a_end] = range(a);
+  const auto [b_begin, b_end] = range(b);
+  return std::less<>{}(a_begin, b_end) && std::less<>{}(b_begin, a_end);
+}
+} // namespace
+
+/// Helper for detecting aliasing of inputs and outputs.
+///
+/// This method is using virtual dispatch as a trick to obtain T, such that the
+/// element views of `a` and `b` can be compared.
+template <class T>
+bool ElementArrayModel<T>::overlaps(const Variable &a,
+                                    const Variable &b) const {
+  if (!b.is_valid() || b.dtype() != a.dtype())
+    return false;
+  return views_overlap(a.values<T>(), b.values<T>()) ||
+         (a.has_variances() && b.has_variances() &&
+          views_overlap(a.variances<T>(), b.variances<T>()));
+}
+
 template <class T>
 void ElementArrayModel<T>::assign(const VariableConcept &other) {
   *this = requireT<const ElementArrayModel<T>>(other);
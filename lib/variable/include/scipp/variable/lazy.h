@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file Lazy evaluation of chains of element-wise operations.
+///
+/// Every operator on Variable materializes its result, so `(a - b) * c / d`
+/// allocates three full-size temporaries and makes multiple passes through
+/// memory. The types in this file record such chains as an expression tree
+/// instead, and `eval` runs the whole tree as a single `transform` over all
+/// leaves. The output unit is computed once from the leaf units, variances are
+/// propagated element-wise within the fused operator.
+///
+/// Example:
+///
+///     using namespace scipp::variable;
+///     Variable out = lazy::eval((lazy::expr(a) - b) * c / lazy::sqrt(d));
+///
+/// Fusion is used when all leaves have the same dtype, either double or float.
+/// Expressions with more than `max_fused_arity` leaves are split into subtrees
+/// which are fused individually. `eval` falls back to eager evaluation, i.e.,
+/// the same operations as without `lazy`, if the dtypes differ or if fusion
+/// would change the result. The latter is the case for correlated variances
+/// from referencing the same variable multiple times, and for trigonometric
+/// functions of angles in degrees.
+/// @author Simon Heybrock
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "scipp/core/element/arithmetic.h"
+#include "scipp/core/element/math.h"
+#include "scipp/core/element/trigonometry.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/math.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/trigonometry.h"
+#include "scipp/variable/variable.h"
+#include "scipp/variable/variable_factory.h"
+
+namespace scipp::variable::lazy {
+
+/// Maximum number of leaves fused into a single pass. This is the maximum
+/// number of inputs supported by `transform`.
+inline constexpr std::size_t max_fused_arity = 4;
+
+namespace ops {
+// Each op provides the element-wise operation (also used for units) and the
+// equivalent eager operation on Variable.
+#define SCIPP_LAZY_BINARY_OP(NAME, ELEMENT, EAGER)                             \
+  struct NAME {                                                                \
+    static constexpr bool requires_rad = false;                                \
+    template <class A, class B>                                                \
+    static constexpr auto element(const A &a, const B &b) {                    \
+      return core::element::ELEMENT(a, b);                                     \
+    }                                                                          \
+    static Variable eager(const Variable &a, const Variable &b) {              \
+      return EAGER;                                                            \
+    }                                                                          \
+  };
+#define SCIPP_LAZY_UNARY_OP(NAME, ELEMENT, EAGER, RAD)                         \
+  struct NAME {                                                                \
+    static constexpr bool requires_rad = RAD;                                  \
+    template <class A> static constexpr auto element(const A &a) {             \
+      return core::element::ELEMENT(a);                                        \
+    }                                                                          \
+    static Variable eager(const Variable &a) { return EAGER; }                 \
+  };
+
+SCIPP_LAZY_BINARY_OP(add, add, a + b)
+SCIPP_LAZY_BINARY_OP(subtract, subtract, a - b)
+SCIPP_LAZY_BINARY_OP(multiply, multiply, a * b)
+SCIPP_LAZY_BINARY_OP(divide, divide, a / b)
+SCIPP_LAZY_UNARY_OP(negative, negative, -a, false)
+SCIPP_LAZY_UNARY_OP(abs, abs, variable::abs(a), false)
+SCIPP_LAZY_UNARY_OP(sqrt, sqrt, variable::sqrt(a), false)
+SCIPP_LAZY_UNARY_OP(exp, exp, variable::exp(a), false)
+SCIPP_LAZY_UNARY_OP(log, log, variable::log(a), false)
+// Element ops for sin, cos, and tan accept deg as unit but assume rad, so the
+// fused path is only used for rad.
+SCIPP_LAZY_UNARY_OP(sin, sin, variable::sin(a), true)
+SCIPP_LAZY_UNARY_OP(cos, cos, variable::cos(a), true)
+SCIPP_LAZY_UNARY_OP(tan, tan, variable::tan(a), true)
+
+#undef SCIPP_LAZY_BINARY_OP
+#undef SCIPP_LAZY_UNARY_OP
+} // namespace ops
+
+/// Leaf of an expression tree, referencing the buffer of a Variable.
+struct Leaf {
+  static constexpr std::size_t arity = 1;
+
+  template <std::size_t I, class Args>
+  static constexpr decltype(auto) element(const Args &args) {
+    return std::get<I>(args);
+  }
+
+  sc_units::Unit unit() const { return variableFactory().elem_unit(var); }
+  bool fusable() const { return true; }
+  Variable eager() const { return var; }
+  template <std::size_t I, std::size_t N>
+  void leaves(std::array<Variable, N> &out) const {
+    out[I] = var;
+  }
+
+  Variable var;
+};
+
+template <class Op, class A> struct Unary {
+  static constexpr std::size_t arity = A::arity;
+
+  template <std::size_t I, class Args>
+  static constexpr auto element(const Args &args) {
+    return Op::element(A::template element<I>(args));
+  }
+
+  sc_units::Unit unit() const { return Op::element(a.unit()); }
+  bool fusable() const {
+    return a.fusable() && (!Op::requires_rad || a.unit() == sc_units::rad);
+  }
+  Variable eager() const { return Op::eager(a.eager()); }
+  template <std::size_t I, std::size_t N>
+  void leaves(std::array<Variable, N> &out) const {
+    a.template leaves<I>(out);
+  }
+
+  A a;
+};
+
+template <class Op, class A, class B> struct Binary {
+  static constexpr std::size_t arity = A::arity + B::arity;
+
+  template <std::size_t I, class Args>
+  static constexpr auto element(const Args &args) {
+    return Op::element(A::template element<I>(args),
+                       B::template element<I + A::arity>(args));
+  }
+
+  sc_units::Unit unit() const { return Op::element(a.unit(), b.unit()); }
+  bool fusable() const { return a.fusable() && b.fusable(); }
+  Variable eager() const { return Op::eager(a.eager(), b.eager()); }
+  template <std::size_t I, std::size_t N>
+  void leaves(std::array<Variable, N> &out) const {
+    a.template leaves<I>(out);
+    b.template leaves<I + A::arity>(out);
+  }
+
+  A a;
+  B b;
+};
+
+template <class T> struct is_expression : std::false_type {};
+template <> struct is_expression<Leaf> : std::true_type {};
+template <class Op, class A>
+struct is_expression<Unary<Op, A>> : std::true_type {};
+template <class Op, class A, class B>
+struct is_expression<Binary<Op, A, B>> : std::true_type {};
+template <class T>
+inline constexpr bool is_expression_v = is_expression<std::decay_t<T>>::value;
+
+template <class T>
+concept Expression = is_expression_v<T>;
+template <class T>
+concept Operand =
+    is_expression_v<T> || std::is_same_v<std::decay_t<T>, Variable>;
+
+/// Start an expression from a variable.
+inline Leaf expr(const Variable &var) { return Leaf{var}; }
+
+namespace detail {
+template <class T> auto as_expression(const T &x) {
+  if constexpr (is_expression_v<T>)
+    return x;
+  else
+    return expr(x);
+}
+
+template <class Op, class A, class B> auto binary(const A &a, const B &b) {
+  using EA = decltype(as_expression(a));
+  using EB = decltype(as_expression(b));
+  return Binary<Op, EA, EB>{as_expression(a), as_expression(b)};
+}
+
+/// Element-wise operator evaluating the entire expression tree `Expr`.
+template <class Expr> struct fused {
+  template <class... Args>
+  constexpr auto operator()(const Args &...args) const {
+    return Expr::template element<0>(std::forward_as_tuple(args...));
+  }
+};
+
+template <class T, std::size_t... Is>
+auto same_type_tuple(std::index_sequence<Is...>)
+    -> std::tuple<std::conditional_t<true, T, decltype(Is)>...>;
+template <class T, std::size_t N>
+using same_type_tuple_t =
+    decltype(same_type_tuple<T>(std::make_index_sequence<N>{}));
+
+template <std::size_t N>
+bool can_fuse_leaves(const std::array<Variable, N> &leaves) {
+  const auto type = variableFactory().elem_dtype(leaves.front());
+  if (type != dtype<double> && type != dtype<float>)
+    return false;
+  for (std::size_t i = 0; i < N; ++i) {
+    if (variableFactory().elem_dtype(leaves[i]) != type)
+      return false;
+    // Variances of the same variable are correlated, eager operations such as
+    // `a + a` handle this explicitly.
+    if (variableFactory().has_variances(leaves[i]))
+      for (std::size_t j = i + 1; j < N; ++j)
+        if (leaves[i].is_same(leaves[j]))
+          return false;
+  }
+  return true;
+}
+
+template <class Expr, std::size_t... Is>
+Variable eval_fused(const std::array<Variable, Expr::arity> &leaves,
+                    std::index_sequence<Is...>) {
+  using types = std::tuple<same_type_tuple_t<double, Expr::arity>,
+                           same_type_tuple_t<float, Expr::arity>>;
+  return variable::detail::transform(types{}, fused<Expr>{}, "lazy",
+                                     leaves[Is]...);
+}
+
+template <class Op, class A> Variable eval_split(const Unary<Op, A> &e);
+template <class Op, class A, class B>
+Variable eval_split(const Binary<Op, A, B> &e);
+} // namespace detail
+
+/// Evaluate an expression, fusing all operations into a single pass if
+/// possible.
+template <Expression Expr> [[nodiscard]] Variable eval(const Expr &e) {
+  if constexpr (Expr::arity > max_fused_arity) {
+    return detail::eval_split(e);
+  } else {
+    std::array<Variable, Expr::arity> leaves;
+    e.template leaves<0>(leaves);
+    if (!e.fusable() || !detail::can_fuse_leaves(leaves))
+      return e.eager();
+    return detail::eval_fused<Expr>(leaves,
+                                    std::make_index_sequence<Expr::arity>{});
+  }
+}
+
+namespace detail {
+// Leaves of a split expression are used as is, without copy.
+inline Variable eval_operand(const Leaf &e) { return e.var; }
+template <Expression Expr> Variable eval_operand(const Expr &e) {
+  return eval(e);
+}
+
+template <class Op, class A> Variable eval_split(const Unary<Op, A> &e) {
+  return Op::eager(eval_operand(e.a));
+}
+template <class Op, class A, class B>
+Variable eval_split(const Binary<Op, A, B> &e) {
+  return Op::eager(eval_operand(e.a), eval_operand(e.b));
+}
+} // namespace detail
+
+template <Operand A, Operand B>
+  requires(is_expression_v<A> || is_expression_v<B>)
+auto operator+(const A &a, const B &b) {
+  return detail::binary<ops::add>(a, b);
+}
+template <Operand A, Operand B>
+  requires(is_expression_v<A> || is_expression_v<B>)
+auto operator-(const A &a, const B &b) {
+  return detail::binary<ops::subtract>(a, b);
+}
+template <Operand A, Operand B>
+  requires(is_expression_v<A> || is_expression_v<B>)
+auto operator*(const A &a, const B &b) {
+  return detail::binary<ops::multiply>(a, b);
+}
+template <Operand A, Operand B>
+  requires(is_expression_v<A> || is_expression_v<B>)
+auto operator/(const A &a, const B &b) {
+  return detail::binary<ops::divide>(a, b);
+}
+
+template <Expression A> auto operator-(const A &a) {
+  return Unary<ops::negative, A>{a};
+}
+template <Expression A> auto abs(const A &a) { return Unary<ops::abs, A>{a}; }
+template <Expression A> auto sqrt(const A &a) {
+  return Unary<ops::sqrt, A>{a};
+}
+template <Expression A> auto exp(const A &a) { return Unary<ops::exp, A>{a}; }
+template <Expression A> auto log(const A &a) { return Unary<ops::log, A>{a}; }
+template <Expression A> auto sin(const A &a) { return Unary<ops::sin, A>{a}; }
+template <Expression A> auto cos(const A &a) { return Unary<ops::cos, A>{a}; }
+template <Expression A> auto tan(const A &a) { return Unary<ops::tan, A>{a}; }
+
+} // namespace scipp::variable::lazy
@@ -46,6 +46,24 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmean(const Variable &var,
                                                      const Dim dim);
 
+// Reductions writing their result into `out`, which is returned.
+SCIPP_VARIABLE_EXPORT Variable &sum(const Variable &var, const Dim dim,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &nansum(const Variable &var, const Dim dim,
+                                       Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &any(const Variable &var, const Dim dim,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &all(const Variable &var, const Dim dim,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &max(const Variable &var, const Dim dim,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &nanmax(const Variable &var, const Dim dim,
+                                       Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &min(const Variable &var, const Dim dim,
+                                    Variable &out);
+SCIPP_VARIABLE_EXPORT Variable &nanmin(const Variable &var, const Dim dim,
+                                       Variable &out);
+
 // Reductions of all events within a bin.
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_sum(const Variable &data);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_nansum(const Variable &data);
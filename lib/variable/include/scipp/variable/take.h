@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include "scipp-variable_export.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable take(const Variable &var,
+                                                  const Variable &indices,
+                                                  const Dim dim);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+compress(const Variable &var, const Variable &condition, const Dim dim);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+flatnonzero(const Variable &condition);
+
+} // namespace scipp::variable
@@ -33,11 +33,13 @@
 #include <algorithm>
 #include <cassert>
 #include <string_view>
+#include <tuple>
 
 #include "scipp/common/overloaded.h"
 
 #include "scipp/core/has_eval.h"
 #include "scipp/core/multi_index.h"
+#include "scipp/core/numa.h"
 #include "scipp/core/parallel.h"
 #include "scipp/core/transform_common.h"
 #include "scipp/core/value_and_variance.h"
@@ -125,18 +127,6 @@ template <size_t I, size_t N_Operands, bool in_place>
 using make_stride_sequence =
     typename stride_sequence<I, N_Operands, in_place>::type;
 
-template <scipp::index... Strides, size_t... Is>
-void increment_impl(std::array<scipp::index, sizeof...(Strides)> &indices,
-                    std::integer_sequence<size_t, Is...>) noexcept {
-  ((indices[Is] += Strides), ...);
-}
-
-template <scipp::index... Strides>
-void increment(std::array<scipp::index, sizeof...(Strides)> &indices) noexcept {
-  increment_impl<Strides...>(indices,
-                             std::make_index_sequence<sizeof...(Strides)>{});
-}
-
 template <size_t N>
 void increment(std::array<scipp::index, N> &indices,
                const std::span<const scipp::index> strides) noexcept {
@@ -189,22 +179,94 @@ static constexpr void call_in_place(Op &&op, const Indices &indices, Arg &&arg,
     arg.variances.data()[i] = arg_.variance;
   }
 }
+
+/// Pointers to the value and variance arrays of an operand. Values and
+/// variances are processed as separate streams in the inner loop.
+template <class T> struct ValueAndVariancePointers {
+  T *values;
+  T *variances;
+};
+template <class T>
+ValueAndVariancePointers(T *, T *) -> ValueAndVariancePointers<T>;
+
+template <class T>
+inline constexpr bool is_ValueAndVariancePointers_v = false;
+template <class T>
+inline constexpr bool
+    is_ValueAndVariancePointers_v<ValueAndVariancePointers<T>> = true;
+
+/// Return pointer(s) to the element at `offset`, so the inner loop can index
+/// into plain arrays instead of going through the view for every element.
+template <class T>
+static constexpr auto element_pointers(T &&range, const scipp::index offset) {
+  if constexpr (has_variances_v<std::decay_t<T>>)
+    return ValueAndVariancePointers{range.values.data() + offset,
+                                    range.variances.data() + offset};
+  else
+    return range.data() + offset;
+}
+
+template <scipp::index Stride, class T>
+static constexpr decltype(auto) load(const T &ptr, const scipp::index i) {
+  if constexpr (is_ValueAndVariancePointers_v<T>)
+    return ValueAndVariance{ptr.values[Stride * i], ptr.variances[Stride * i]};
+  else
+    return ptr[Stride * i];
+}
+
+/// Inner loop over pointers with strides known at compile time.
+///
+/// All pointers and strides are loop-invariant locals and the only induction
+/// variable is `i`, which enables the compiler to vectorize the loop also when
+/// variances are involved, since ValueAndVariance is fully inlined into
+/// separate value and variance streams.
+template <bool in_place, class Op, scipp::index OutStride,
+          scipp::index... Strides, class Out, class... Args>
+static void
+pointer_loop(Op &&op,
+             std::integer_sequence<scipp::index, OutStride, Strides...>,
+             const scipp::index n, const Out out, const Args... args) {
+  for (scipp::index i = 0; i < n; ++i) {
+    if constexpr (is_ValueAndVariancePointers_v<Out>) {
+      using T =
+          std::remove_const_t<std::remove_pointer_t<decltype(out.values)>>;
+      ValueAndVariance<T> out_{T{}, T{}};
+      if constexpr (in_place) {
+        out_ = ValueAndVariance{out.values[OutStride * i],
+                                out.variances[OutStride * i]};
+        op(out_, load<Strides>(args, i)...);
+      } else {
+        out_ = op(load<Strides>(args, i)...);
+      }
+      out.values[OutStride * i] = out_.value;
+      out.variances[OutStride * i] = out_.variance;
+    } else if constexpr (in_place) {
+      op(out[OutStride * i], load<Strides>(args, i)...);
+    } else {
+      out[OutStride * i] = op(load<Strides>(args, i)...);
+    }
+  }
+}
+
+template <bool in_place, class Op, class Indices, class Sequence,
+          class... Operands, size_t... I>
+static void inner_loop_impl(Op &&op, const Indices &indices, Sequence strides,
+                            const scipp::index n, std::index_sequence<I...>,
+                            Operands &&...operands) {
+  pointer_loop<in_place>(std::forward<Op>(op), strides, n,
+                         element_pointers(operands, indices[I])...);
+}
+
 /// Run transform with strides known at compile time.
 template <bool in_place, class Op, class... Operands, scipp::index... Strides>
 static void inner_loop(Op &&op,
                        std::array<scipp::index, sizeof...(Operands)> indices,
-                       std::integer_sequence<scipp::index, Strides...>,
+                       std::integer_sequence<scipp::index, Strides...> strides,
                        const scipp::index n, Operands &&...operands) {
   static_assert(sizeof...(Operands) == sizeof...(Strides));
-
-  for (scipp::index i = 0; i < n; ++i) {
-    if constexpr (in_place) {
-      detail::call_in_place(op, indices, std::forward<Operands>(operands)...);
-    } else {
-      detail::call(op, indices, std::forward<Operands>(operands)...);
-    }
-    detail::increment<Strides...>(indices);
-  }
+  inner_loop_impl<in_place>(std::forward<Op>(op), indices, strides, n,
+                            std::make_index_sequence<sizeof...(Operands)>{},
+                            std::forward<Operands>(operands)...);
 }
 
 /// Run transform with strides known at run time but bypassing MultiIndex.
@@ -223,14 +285,31 @@ static void inner_loop(Op &&op,
   }
 }
 
+/// Run transform with an operator processing the entire inner loop at once.
+///
+/// Operands with variances are passed as ValueAndVariancePointers.
+template <class Op, class... Operands, size_t... I>
+static void
+batch_loop(Op &&op,
+           const std::array<scipp::index, sizeof...(Operands)> &indices,
+           const std::span<const scipp::index> strides, const scipp::index n,
+           std::index_sequence<I...>, Operands &&...operands) {
+  op(n, strides, element_pointers(operands, indices[I])...);
+}
+
 template <bool in_place, size_t I = 0, class Op, class... Operands>
 static void dispatch_inner_loop(
     Op &&op, const std::array<scipp::index, sizeof...(Operands)> &indices,
     const std::span<const scipp::index> inner_strides, const scipp::index n,
     Operands &&...operands) {
   constexpr auto N_Operands = sizeof...(Operands);
-  if constexpr (I ==
-                detail::stride_special_cases<N_Operands, in_place>.size()) {
+  if constexpr (std::is_base_of_v<core::transform_flags::batch_t,
+                                  std::decay_t<Op>>) {
+    batch_loop(std::forward<Op>(op), indices, inner_strides, n,
+               std::make_index_sequence<N_Operands>{},
+               std::forward<Operands>(operands)...);
+  } else if constexpr (I == detail::stride_special_cases<N_Operands,
+                                                         in_place>.size()) {
     inner_loop<in_place>(std::forward<Op>(op), indices, inner_strides, n,
                          std::forward<Operands>(operands)...);
   } else {
@@ -274,8 +353,7 @@ static void transform_elements(Op op, Out &&out, Ts &&...other) {
     end.set_index(range.end());
     run(indices, end);
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
-                               run_parallel);
+  core::numa::parallel_for(out.size(), run_parallel);
 }
 
 template <class T> static constexpr auto maybe_eval(T &&_) {
@@ -521,8 +599,7 @@ template <bool dry_run> struct in_place {
         end.set_index(range.end());
         run(indices, end);
       };
-      core::parallel::parallel_for(core::parallel::blocked_range(0, arg.size()),
-                                   run_parallel);
+      core::numa::parallel_for(arg.size(), run_parallel);
     }
   }
 
@@ -612,16 +689,17 @@ template <bool dry_run> struct in_place {
     template <class T, class... Ts>
     void operator()(T &&out, Ts &&...handles) const {
       using namespace detail;
-      // If there is an overlap between lhs and rhs we copy the rhs before
-      // applying the operation.
+      // If there is an overlap between lhs and any rhs we copy the
+      // overlapping rhs before applying the operation.
       if ((overlaps(out, handles) || ...)) {
-        if constexpr (sizeof...(Ts) == 1) {
-          auto copy = (handles.clone(), ...);
-          return operator()(std::forward<T>(out), Ts(copy)...);
-        } else {
-          throw std::runtime_error(
-              "Overlap handling only implemented for 2 inputs.");
-        }
+        auto copies = std::tuple{
+            (overlaps(out, handles) ? handles.clone() : Variable{})...};
+        return std::apply(
+            [&](auto &...copy) {
+              return operator()(std::forward<T>(out),
+                                (copy.is_valid() ? Ts(copy) : handles)...);
+            },
+            copies);
       }
       const auto dims = merge(out.dims(), handles.dims()...);
       auto out_view = as_view{out, dims};
@@ -48,4 +48,7 @@ SCIPP_VARIABLE_EXPORT void fill_zeros(Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable as_contiguous(const Variable &var,
                                                            const Dim dim);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+has_default_layout(const Variable &var);
+
 } // namespace scipp::variable
@@ -52,6 +52,7 @@ public:
 
   virtual bool equals(const Variable &a, const Variable &b) const = 0;
   virtual bool equals_nan(const Variable &a, const Variable &b) const = 0;
+  virtual bool overlaps(const Variable &a, const Variable &b) const;
   virtual void copy(const Variable &src, Variable &dest) const = 0;
   virtual void copy(const Variable &src, Variable &&dest) const = 0;
   virtual void assign(const VariableConcept &other) = 0;
@@ -44,6 +44,10 @@ public:
   virtual Variable empty_like(const Variable &prototype,
                               const std::optional<Dimensions> &shape,
                               const Variable &sizes) const = 0;
+  [[nodiscard]] virtual Variable
+  with_bin_indices(const Variable &, const Variable &) const {
+    throw unreachable();
+  }
   [[nodiscard]] virtual Variable apply_event_masks(const Variable &var,
                                                    const FillValue) const {
     return var;
@@ -111,6 +115,10 @@ public:
   Variable empty_like(const Variable &prototype,
                       const std::optional<Dimensions> &shape,
                       const Variable &sizes = {});
+  /// Return a binned variable with given bin indices, sharing the buffer of
+  /// `prototype`.
+  [[nodiscard]] Variable with_bin_indices(const Variable &prototype,
+                                          const Variable &indices) const;
   /// Return a binned variable where masked elements are replaced by fill.
   /// Coords and attrs of the input are not propagated to the output.
   [[nodiscard]] Variable apply_event_masks(const Variable &var,
@@ -17,21 +17,23 @@ using namespace scipp::core::element;
 
 namespace scipp::variable {
 
-template <typename T, class Less>
-void rebin_non_inner(const Dim dim, const Variable &oldT,
-                     // cppcheck-suppress constParameter # bug in cppcheck
-                     const Variable &newT, const Variable &oldCoord,
-                     const Variable &newCoord) {
-  if (oldCoord.ndim() != 1 || newCoord.ndim() != 1)
-    throw std::invalid_argument(
-        "Internal error in rebin, this should be unreachable.");
-  const auto oldSize = oldT.dims()[dim];
-  const auto newSize = newT.dims()[dim];
-
-  const auto *xold = oldCoord.values<T>().data();
-  const auto *xnew = newCoord.values<T>().data();
+namespace {
+/// Contribution of an old bin to a new bin, as the fraction of the old bin
+/// that overlaps with the new bin.
+struct Contribution {
+  scipp::index iold;
+  double scale;
+};
 
-  auto add_from_bin = [&](auto &&slice, const auto xn_low, const auto xn_high,
+/// Return contributions of old bins to each new bin, in CSR format.
+template <typename T, class Less>
+auto rebin_contributions(const std::span<const T> xold,
+                         const std::span<const T> xnew) {
+  const auto oldSize = scipp::size(xold) - 1;
+  const auto newSize = scipp::size(xnew) - 1;
+  std::vector<scipp::index> offsets(newSize + 1);
+  std::vector<Contribution> contributions;
+  auto add_from_bin = [&](const auto xn_low, const auto xn_high,
                           const scipp::index iold) {
     auto xo_low = xold[iold];
     auto xo_high = xold[iold + 1];
@@ -39,36 +41,117 @@ void rebin_non_inner(const Dim dim, const Variable &oldT,
     const auto delta = std::abs(std::min<double>(xn_high, xo_high, Less{}) -
                                 std::max<double>(xn_low, xo_low, Less{}));
     const auto owidth = std::abs(xo_high - xo_low);
-    slice += oldT.slice({dim, iold}) *
-             ((delta / owidth) * (slice.unit() / oldT.unit()));
+    contributions.push_back({iold, delta / owidth});
   };
-  auto accumulate_bin = [&](auto &&slice, const auto xn_low,
-                            const auto xn_high) {
+  for (scipp::index inew = 0; inew < newSize; ++inew) {
+    offsets[inew] = scipp::size(contributions);
+    const auto xn_low = xnew[inew];
+    const auto xn_high = xnew[inew + 1];
     scipp::index begin =
-        std::upper_bound(xold, xold + oldSize + 1, xn_low, Less{}) - xold;
+        std::upper_bound(xold.begin(), xold.end(), xn_low, Less{}) -
+        xold.begin();
     scipp::index end =
-        std::upper_bound(xold, xold + oldSize + 1, xn_high, Less{}) - xold;
+        std::upper_bound(xold.begin(), xold.end(), xn_high, Less{}) -
+        xold.begin();
     if (begin == oldSize + 1 || end == 0)
-      return;
+      continue;
     begin = std::max(scipp::index(0), begin - 1);
-    add_from_bin(slice, xn_low, xn_high, begin);
-    if (begin + 1 < end - 1)
-      sum_into(slice, oldT.slice({dim, begin + 1, end - 1}));
+    add_from_bin(xn_low, xn_high, begin);
+    for (scipp::index iold = begin + 1; iold < end - 1; ++iold)
+      contributions.push_back({iold, 1.0});
     if (begin != end - 1 && end < oldSize + 1)
-      add_from_bin(slice, xn_low, xn_high, end - 1);
-  };
-  auto accumulate_bins = [&](const auto &range) {
-    for (scipp::index inew = range.begin(); inew < range.end(); ++inew) {
-      auto xn_low = xnew[inew];
-      auto xn_high = xnew[inew + 1];
-      accumulate_bin(newT.slice({dim, inew}), xn_low, xn_high);
+      add_from_bin(xn_low, xn_high, end - 1);
+  }
+  offsets[newSize] = scipp::size(contributions);
+  return std::pair{std::move(offsets), std::move(contributions)};
+}
+
+/// Add scaled rows of `in` to each row of `out`.
+///
+/// Both buffers have layout (outer, dim, inner) with contiguous rows of length
+/// n_inner, so the innermost loop can be vectorized. Parallelized over outer
+/// dims and new bins.
+template <class Out, class In>
+void rebin_rows(Out *out, const In *in, const scipp::index n_outer,
+                const scipp::index oldSize, const scipp::index newSize,
+                const scipp::index n_inner,
+                const std::vector<scipp::index> &offsets,
+                const std::vector<Contribution> &contributions,
+                const bool variances) {
+  auto rebin_range = [&](const auto &range) {
+    for (scipp::index row = range.begin(); row < range.end(); ++row) {
+      const auto outer = row / newSize;
+      const auto inew = row % newSize;
+      Out *out_row = out + row * n_inner;
+      std::fill_n(out_row, n_inner, Out{0});
+      for (auto c = offsets[inew]; c < offsets[inew + 1]; ++c) {
+        const auto [iold, scale] = contributions[c];
+        const auto factor = variances ? scale * scale : scale;
+        const In *in_row = in + (outer * oldSize + iold) * n_inner;
+        for (scipp::index i = 0; i < n_inner; ++i)
+          out_row[i] += static_cast<Out>(in_row[i] * factor);
+      }
     }
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, newSize),
-                               accumulate_bins);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, n_outer * newSize), rebin_range);
+}
+
+template <class Out, class In>
+void rebin_non_inner_typed(const Dim dim, const Variable &oldT,
+                           Variable &newT,
+                           const std::vector<scipp::index> &offsets,
+                           const std::vector<Contribution> &contributions) {
+  const auto &dims = oldT.dims();
+  const auto axis = dims.index(dim);
+  scipp::index n_outer = 1;
+  scipp::index n_inner = 1;
+  for (scipp::index i = 0; i < axis; ++i)
+    n_outer *= dims.size(i);
+  for (scipp::index i = axis + 1; i < dims.ndim(); ++i)
+    n_inner *= dims.size(i);
+  const auto oldSize = dims[dim];
+  const auto newSize = newT.dims()[dim];
+  rebin_rows(newT.values<Out>().data(), oldT.values<In>().data(), n_outer,
+             oldSize, newSize, n_inner, offsets, contributions, false);
+  if constexpr (core::canHaveVariances<In>())
+    if (oldT.has_variances())
+      rebin_rows(newT.variances<Out>().data(), oldT.variances<In>().data(),
+                 n_outer, oldSize, newSize, n_inner, offsets, contributions,
+                 true);
+}
+
+template <typename T, class Less>
+void rebin_non_inner(const Dim dim, const Variable &var, Variable &newT,
+                     const Variable &oldCoord, const Variable &newCoord) {
+  if (oldCoord.ndim() != 1 || newCoord.ndim() != 1)
+    throw std::invalid_argument(
+        "Internal error in rebin, this should be unreachable.");
+  const auto [offsets, contributions] = rebin_contributions<T, Less>(
+      oldCoord.values<T>().as_span(), newCoord.values<T>().as_span());
+  // The kernel requires the default memory layout. Other layouts such as
+  // transposed or sliced input are rare, so a copy is sufficient.
+  const auto oldT = has_default_layout(var) ? var : copy(var);
+  if (oldT.dtype() == dtype<double>)
+    rebin_non_inner_typed<double, double>(dim, oldT, newT, offsets,
+                                          contributions);
+  else if (oldT.dtype() == dtype<float>)
+    rebin_non_inner_typed<float, float>(dim, oldT, newT, offsets,
+                                        contributions);
+  else if (oldT.dtype() == dtype<int64_t>)
+    rebin_non_inner_typed<double, int64_t>(dim, oldT, newT, offsets,
+                                           contributions);
+  else if (oldT.dtype() == dtype<int32_t>)
+    rebin_non_inner_typed<double, int32_t>(dim, oldT, newT, offsets,
+                                           contributions);
+  else if (oldT.dtype() == dtype<bool>)
+    rebin_non_inner_typed<double, bool>(dim, oldT, newT, offsets,
+                                        contributions);
+  else
+    throw except::TypeError("Rebinning is not possible for data of type " +
+                            to_string(oldT.dtype()) + ".");
 }
 
-namespace {
 template <class Out, class OutEdge, class In, class InEdge>
 using args = std::tuple<std::span<Out>, std::span<const OutEdge>,
                         std::span<const In>, std::span<const InEdge>>;
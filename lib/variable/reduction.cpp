@@ -7,6 +7,7 @@
 #include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
+#include "scipp/core/except.h"
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
@@ -23,6 +24,68 @@ using namespace scipp::core;
 namespace scipp::variable {
 
 namespace {
+/// Pairwise summation of `n` elements with given stride, as used by numpy. The
+/// rounding error grows as O(log n) instead of O(n) for naive summation.
+template <class T>
+double pairwise_sum(const T *x, const scipp::index stride,
+                    const scipp::index n) {
+  constexpr scipp::index block_size = 128;
+  if (n > block_size) {
+    const auto half = n / 2 / 8 * 8;
+    return pairwise_sum(x, stride, half) +
+           pairwise_sum(x + half * stride, stride, n - half);
+  }
+  // Multiple accumulators break the dependency chain between additions.
+  std::array<double, 8> r{};
+  scipp::index i = 0;
+  for (; i + 8 <= n; i += 8)
+    for (scipp::index j = 0; j < 8; ++j)
+      r[j] += x[(i + j) * stride];
+  double res =
+      ((r[0] + r[1]) + (r[2] + r[3])) + ((r[4] + r[5]) + (r[6] + r[7]));
+  for (; i < n; ++i)
+    res += x[i * stride];
+  return res;
+}
+
+template <class T> auto values_of(const T &ptr) {
+  if constexpr (detail::is_ValueAndVariancePointers_v<T>)
+    return ptr.values;
+  else
+    return ptr;
+}
+
+/// Like element::add_equals, but using pairwise summation when reducing along
+/// the inner loop.
+constexpr auto add_equals_pairwise = overloaded{
+    element::arg_list<double, std::tuple<double, float>>,
+    transform_flags::batch,
+    [](auto &&a, const auto &b) { a += b; },
+    [](const scipp::index n, const std::span<const scipp::index> strides,
+       const auto &out, const auto &in) {
+      using Out = std::decay_t<decltype(out)>;
+      using In = std::decay_t<decltype(in)>;
+      constexpr bool variances = detail::is_ValueAndVariancePointers_v<Out> &&
+                                 detail::is_ValueAndVariancePointers_v<In>;
+      if (strides[0] == 0) {
+        *values_of(out) += pairwise_sum(values_of(in), strides[1], n);
+        if constexpr (variances)
+          *out.variances += pairwise_sum(in.variances, strides[1], n);
+      } else {
+        const auto add = [n, strides](auto *a, const auto *b) {
+          if (strides[0] == 1 && strides[1] == 1)
+            for (scipp::index i = 0; i < n; ++i)
+              a[i] += b[i];
+          else
+            for (scipp::index i = 0; i < n; ++i)
+              a[i * strides[0]] += b[i * strides[1]];
+        };
+        add(values_of(out), values_of(in));
+        if constexpr (variances)
+          add(out.variances, in.variances);
+      }
+    }};
+
 Variable reduce_to_dims(const Variable &var, const Dimensions &target_dims,
                         void (*const op)(Variable &, const Variable &),
                         const FillValue init) {
@@ -46,6 +109,38 @@ Variable reduce_dim(const Variable &var, const Dim dim,
   return reduce_to_dims(var, dims, op, init);
 }
 
+/// Like reduce_dim but writing into the preallocated `out`.
+///
+/// `out` must have the dims, dtype, and variances of the result of reduce_dim.
+/// Its unit is set by the reduction.
+Variable &reduce_dim_into(const Variable &var, const Dim dim, Variable &out,
+                          void (*const op)(Variable &, const Variable &),
+                          const FillValue init) {
+  auto dims = var.dims();
+  dims.erase(dim);
+  const auto init_value = dense_special_like(var, Dimensions{}, init);
+  if (out.dims() != dims)
+    throw except::DimensionError("Expected output with dimensions " +
+                                 to_string(dims) + ", got " +
+                                 to_string(out.dims()) + '.');
+  if (out.dtype() != init_value.dtype())
+    throw except::TypeError("Expected output with dtype " +
+                            to_string(init_value.dtype()) + ", got " +
+                            to_string(out.dtype()) + '.');
+  if (out.has_variances() != init_value.has_variances())
+    throw except::VariancesError(
+        init_value.has_variances() ? "Expected output with variances."
+                                   : "Expected output without variances.");
+  // `out` is initialized before `var` is read, so `var` must not overlap with
+  // `out`.
+  const auto input = out.data().overlaps(out, var) ? copy(var) : var;
+  fill(out, init_value);
+  op(out, variableFactory().apply_event_masks(
+              input,
+              (init == FillValue::ZeroNotBool) ? FillValue::Default : init));
+  return out;
+}
+
 Variable reduce_bins(const Variable &data,
                      void (*const op)(Variable &, const Variable &),
                      const FillValue init) {
@@ -105,6 +200,42 @@ Variable nanmin(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, nanmin_into, FillValue::Max);
 }
 
+/// Reductions along a dimension writing into a preallocated output.
+///
+/// `out` is overwritten and returned. It must match the dims, dtype, and
+/// presence of variances of the result of the respective allocating overload.
+Variable &sum(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, sum_into, FillValue::ZeroNotBool);
+}
+
+Variable &nansum(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, nansum_into, FillValue::ZeroNotBool);
+}
+
+Variable &any(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, any_into, FillValue::False);
+}
+
+Variable &all(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, all_into, FillValue::True);
+}
+
+Variable &max(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, max_into, FillValue::Lowest);
+}
+
+Variable &nanmax(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, nanmax_into, FillValue::Lowest);
+}
+
+Variable &min(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, min_into, FillValue::Max);
+}
+
+Variable &nanmin(const Variable &var, const Dim dim, Variable &out) {
+  return reduce_dim_into(var, dim, out, nanmin_into, FillValue::Max);
+}
+
 Variable mean_impl(const Variable &var, const Dim dim, const Variable &count) {
   return normalize_impl(sum(var, dim), count);
 }
@@ -262,6 +393,9 @@ void sum_into(Variable &accum, const Variable &var) {
     auto x = astype(accum, dtype<double>);
     sum_into(x, var);
     copy(astype(x, dtype<float>), accum);
+  } else if (accum.dtype() == dtype<double> &&
+             (var.dtype() == dtype<double> || var.dtype() == dtype<float>)) {
+    accumulate_in_place(accum, var, add_equals_pairwise, "sum");
   } else {
     accumulate_in_place(accum, var, element::add_equals, "sum");
   }
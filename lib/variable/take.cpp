@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <algorithm>
+
+#include "scipp/core/element/take.h"
+#include "scipp/core/except.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/subspan_view.h"
+#include "scipp/variable/take.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/util.h"
+#include "scipp/variable/variable_factory.h"
+
+namespace scipp::variable {
+
+namespace {
+/// If `dim` is not the contiguous dimension, slices along `dim` with at least
+/// this many elements are copied as a whole instead of first making `dim`
+/// contiguous.
+constexpr scipp::index min_slice_volume_for_slice_copy = 256;
+
+void expect_valid_indices(const Variable &indices, const Dim dim,
+                          const scipp::index size) {
+  if (indices.dtype() != dtype<int64_t>)
+    throw except::TypeError("Indices must have dtype int64, got " +
+                            to_string(indices.dtype()) + '.');
+  if (indices.dims().ndim() != 1)
+    throw except::DimensionError("Indices must be 1-D, got " +
+                                 to_string(indices.dims()) + '.');
+  for (const auto index : indices.values<int64_t>())
+    if (index < 0 || index >= size)
+      throw except::SliceError("Index " + std::to_string(index) +
+                               " is out of range for dimension " +
+                               to_string(dim) + " of length " +
+                               std::to_string(size) + '.');
+}
+
+bool has_take_kernel(const DType dtype) {
+  return dtype == scipp::dtype<double> || dtype == scipp::dtype<float> ||
+         dtype == scipp::dtype<int64_t> || dtype == scipp::dtype<int32_t> ||
+         dtype == scipp::dtype<bool> ||
+         dtype == scipp::dtype<core::time_point> ||
+         dtype == scipp::dtype<std::string> ||
+         dtype == scipp::dtype<Eigen::Vector3d>;
+}
+
+Variable empty_taken(const Variable &var, Dimensions dims) {
+  return empty(dims, var.unit(), var.dtype(), var.has_variances(),
+               var.is_aligned());
+}
+
+Variable take_slices(const Variable &var, const Variable &indices,
+                     const Dim dim) {
+  auto dims = var.dims();
+  dims.resize(dim, indices.dims().volume());
+  auto out = empty_taken(var, dims);
+  scipp::index i = 0;
+  for (const auto index : indices.values<int64_t>())
+    copy(var.slice({dim, index}), out.slice({dim, i++}));
+  return out;
+}
+
+Variable take_dense(const Variable &var, const Variable &indices,
+                    const Dim dim) {
+  // Valid indices into an empty dim are empty.
+  if (var.dims()[dim] == 0)
+    return empty_taken(var, var.dims());
+  const auto slice_volume = var.dims().volume() / var.dims()[dim];
+  if (!has_take_kernel(var.dtype()) ||
+      (var.stride(dim) != 1 &&
+       slice_volume >= min_slice_volume_for_slice_copy))
+    return take_slices(var, indices, dim);
+  const auto contiguous = as_contiguous(var, dim);
+  auto dims = var.dims();
+  dims.erase(dim);
+  dims.addInner(dim, indices.dims().volume());
+  auto out = empty_taken(var, dims);
+  const auto contiguous_indices = as_contiguous(indices, indices.dim());
+  transform_in_place(subspan_view(out, dim), subspan_view(contiguous, dim),
+                     subspan_view(contiguous_indices, indices.dim()),
+                     core::element::take, "take");
+  const auto labels = var.dims().labels();
+  if (std::equal(labels.begin(), labels.end(), out.dims().labels().begin()))
+    return out;
+  return copy(transpose(out, labels));
+}
+} // namespace
+
+/// Return the elements of `var` at the given positions along `dim`.
+///
+/// `indices` must be 1-D with dtype int64. The output has the length of
+/// `indices` along `dim`. Each output element is copied only once, i.e., this
+/// is considerably faster than copying a list of slices.
+///
+/// For binned variables only the bin indices are gathered, the output shares
+/// the buffer with `var`. This includes duplicate indices, which yield bins
+/// referring to the same events, i.e., modifying the events of one such bin
+/// modifies all of them as well as `var`. Use `copy` to obtain independent
+/// bins.
+Variable take(const Variable &var, const Variable &indices, const Dim dim) {
+  expect_valid_indices(indices, dim, var.dims()[dim]);
+  if (!is_bins(var))
+    return take_dense(var, indices, dim);
+  const auto [begin, end] = unzip(var.bin_indices());
+  auto out = variableFactory().with_bin_indices(
+      var, zip(take_dense(begin, indices, dim), take_dense(end, indices, dim)));
+  out.set_aligned(var.is_aligned());
+  return out;
+}
+
+/// Return the slices of `var` along `dim` where `condition` is true.
+///
+/// `condition` must be a 1-D boolean variable with dimension `dim`.
+Variable compress(const Variable &var, const Variable &condition,
+                  const Dim dim) {
+  if (condition.dims().ndim() != 1 || condition.dim() != dim ||
+      condition.dims()[dim] != var.dims()[dim])
+    throw except::DimensionError(
+        "Condition must be 1-D along dimension " + to_string(dim) +
+        " of length " + std::to_string(var.dims()[dim]) + ", got " +
+        to_string(condition.dims()) + '.');
+  return take(var, flatnonzero(condition), dim);
+}
+
+/// Return the positions of the true elements of the 1-D boolean `condition`.
+Variable flatnonzero(const Variable &condition) {
+  if (condition.dtype() != dtype<bool>)
+    throw except::TypeError("Condition must have dtype bool, got " +
+                            to_string(condition.dtype()) + '.');
+  if (condition.dims().ndim() != 1)
+    throw except::DimensionError("Condition must be 1-D, got " +
+                                 to_string(condition.dims()) + '.');
+  const auto values = condition.values<bool>();
+  std::vector<int64_t> indices;
+  indices.reserve(std::count(values.begin(), values.end(), true));
+  for (scipp::index i = 0; i < scipp::size(values); ++i)
+    if (values[i])
+      indices.push_back(i);
+  return makeVariable<int64_t>(Dims{condition.dim()}, Shape{indices.size()},
+                               Values(std::move(indices)));
+}
+
+} // namespace scipp::variable
@@ -2,6 +2,8 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "scipp/core/element/arg_list.h"
 
 #include "scipp/variable/accumulate.h"
@@ -171,3 +173,45 @@ TEST_F(AccumulateTest, 1d_to_scalar_non_idempotent_init) {
     EXPECT_EQ(result, 2 * sc_units::one * expected) << i;
   }
 }
+
+namespace {
+auto make_iota(const Dimensions &dims) {
+  auto var = makeVariable<int64_t>(dims);
+  std::iota(var.values<int64_t>().begin(), var.values<int64_t>().end(), 0);
+  return var;
+}
+} // namespace
+
+TEST_F(AccumulateTest, 3d_inner_large) {
+  // Large enough for multi-threading, partitioned over both output dims.
+  const auto var = make_iota({{Dim::X, Dim::Y, Dim::Z}, {3, 5000, 7}});
+  auto expected = makeVariable<int64_t>(Dims{Dim::X, Dim::Y}, Shape{3, 5000});
+  for (scipp::index i = 0; i < 3 * 5000; ++i)
+    expected.values<int64_t>()[i] = 49 * i + 21;
+  auto result = makeVariable<int64_t>(Dims{Dim::X, Dim::Y}, Shape{3, 5000});
+  accumulate_in_place<pair_self_t<int64_t>>(result, var, op, name);
+  EXPECT_EQ(result, expected);
+}
+
+TEST_F(AccumulateTest, 3d_middle_large) {
+  const auto var = make_iota({{Dim::X, Dim::Y, Dim::Z}, {3, 1000, 20}});
+  auto expected = makeVariable<int64_t>(Dims{Dim::X, Dim::Z}, Shape{3, 20});
+  for (scipp::index x = 0; x < 3; ++x)
+    for (scipp::index z = 0; z < 20; ++z)
+      expected.values<int64_t>()[x * 20 + z] =
+          1000 * (x * 20000 + z) + 20 * 499500;
+  auto result = makeVariable<int64_t>(Dims{Dim::X, Dim::Z}, Shape{3, 20});
+  accumulate_in_place<pair_self_t<int64_t>>(result, var, op, name);
+  EXPECT_EQ(result, expected);
+}
+
+TEST_F(AccumulateTest, 2d_outer_large) {
+  // Reduction of outer dim is chunked, partial results are combined as tree.
+  const auto var = make_iota({{Dim::X, Dim::Y}, {50, 1000}});
+  auto expected = makeVariable<int64_t>(Dims{Dim::Y}, Shape{1000});
+  for (scipp::index y = 0; y < 1000; ++y)
+    expected.values<int64_t>()[y] = 1000 * 1225 + 50 * y;
+  auto result = makeVariable<int64_t>(Dims{Dim::Y}, Shape{1000});
+  accumulate_in_place<pair_self_t<int64_t>>(result, var, op, name);
+  EXPECT_EQ(result, expected);
+}
@@ -5,10 +5,14 @@
 
 #include <gtest/gtest.h>
 
+#include "scipp/core/except.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/pow.h"
+#include "scipp/variable/shape.h"
+
+#include "test_macros.h"
 
 using namespace scipp;
 
@@ -118,3 +122,82 @@ TEST(ArithmeticTest, binned_x_plus_x_with_variances_equals_2_x) {
   const auto two = makeVariable<double>(Values{2.0});
   EXPECT_EQ(x + x, two * x);
 }
+
+class ArithmeticOutTest : public ::testing::Test {
+protected:
+  Variable a = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                    Values{1.0, 2.0, 3.0, 4.0, 5.0, 6.0},
+                                    sc_units::m);
+  Variable b = makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                    Values{0.5, 1.5, 2.5}, sc_units::m);
+  Variable out = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3});
+};
+
+TEST_F(ArithmeticOutTest, matches_allocating_operators) {
+  EXPECT_EQ(add(a, b, out), a + b);
+  EXPECT_EQ(out, a + b);
+  EXPECT_EQ(subtract(a, b, out), a - b);
+  EXPECT_EQ(multiply(a, b, out), a * b);
+  EXPECT_EQ(out.unit(), sc_units::m * sc_units::m);
+  EXPECT_EQ(divide(a, b, out), a / b);
+  EXPECT_EQ(out.unit(), sc_units::one);
+}
+
+TEST_F(ArithmeticOutTest, returns_out) {
+  EXPECT_EQ(&add(a, b, out), &out);
+}
+
+TEST_F(ArithmeticOutTest, out_can_alias_inputs) {
+  const auto expected = transpose(b - a);
+  auto lhs = copy(a);
+  EXPECT_EQ(subtract(lhs, b, lhs), a - b);
+  auto rhs = copy(a);
+  EXPECT_EQ(subtract(b, rhs, rhs), expected);
+}
+
+TEST_F(ArithmeticOutTest, slice_of_out) {
+  auto buffer = makeVariable<double>(Dims{Dim::Z, Dim::Y, Dim::X},
+                                     Shape{2, 2, 3}, sc_units::m);
+  auto slice = buffer.slice({Dim::Z, 1});
+  add(a, b, slice);
+  EXPECT_EQ(buffer.slice({Dim::Z, 1}), a + b);
+  EXPECT_EQ(buffer.slice({Dim::Z, 0}),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                 sc_units::m));
+}
+
+TEST_F(ArithmeticOutTest, with_variances) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                      Values{1.0, 2.0, 3.0},
+                                      Variances{1.0, 1.0, 1.0});
+  auto result = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                     Values{}, Variances{});
+  a.setUnit(sc_units::one);
+  EXPECT_EQ(multiply(a, x, result), a * x);
+  EXPECT_EQ(multiply(x, a, result), transpose(x * a));
+  auto row = result.slice({Dim::Y, 0});
+  EXPECT_EQ(add(x, x, row), x + x);
+}
+
+TEST_F(ArithmeticOutTest, bad_out_throws) {
+  auto bad_dims = makeVariable<double>(Dims{Dim::X}, Shape{3});
+  EXPECT_THROW_DISCARD(add(a, b, bad_dims), except::DimensionError);
+  auto bad_variances = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                            Values{}, Variances{});
+  EXPECT_THROW_DISCARD(add(a, b, bad_variances), except::VariancesError);
+  auto bad_dtype = makeVariable<int64_t>(Dims{Dim::Y, Dim::X}, Shape{2, 3});
+  EXPECT_THROW_DISCARD(divide(a, b, bad_dtype), except::TypeError);
+}
+
+TEST(ArithmeticTest, binned_add_into_out) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 1}, std::pair{1, 3}});
+  const auto buffer = makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                           Values{1.0, 2.0, 3.0}, sc_units::m);
+  const auto x = make_bins(indices, Dim::X, buffer);
+  const auto y = makeVariable<double>(Dims{Dim::Y}, Shape{2},
+                                      Values{10.0, 20.0}, sc_units::m);
+  auto out = copy(x);
+  EXPECT_EQ(add(x, y, out), x + y);
+  EXPECT_EQ(out, x + y);
+}
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/comparison.h"
+#include "scipp/variable/lazy.h"
+#include "scipp/variable/math.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/trigonometry.h"
+#include "scipp/variable/util.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class LazyTest : public ::testing::Test {
+protected:
+  Variable a = makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                    Values{1.0, 2.0, 3.0});
+  Variable b = makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                    Values{4.0, 6.0, 9.0});
+  Variable c = makeVariable<double>(Dims{Dim::Y}, Shape{2}, sc_units::s,
+                                    Values{2.0, 3.0});
+  Variable d = makeVariable<double>(sc_units::kg, Values{2.0});
+};
+
+TEST_F(LazyTest, binary) {
+  EXPECT_EQ(lazy::eval(lazy::expr(a) + b), a + b);
+  EXPECT_EQ(lazy::eval(lazy::expr(a) - b), a - b);
+  EXPECT_EQ(lazy::eval(lazy::expr(a) * b), a * b);
+  EXPECT_EQ(lazy::eval(lazy::expr(a) / b), a / b);
+}
+
+TEST_F(LazyTest, variable_on_left) {
+  EXPECT_EQ(lazy::eval(a - lazy::expr(b)), a - b);
+}
+
+TEST_F(LazyTest, chain_broadcasts_like_eager) {
+  const auto expected = (a - b) * c / d;
+  const auto result = lazy::eval((lazy::expr(a) - b) * c / d);
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(result.dims(), expected.dims());
+  EXPECT_EQ(result.unit(), sc_units::m * sc_units::s / sc_units::kg);
+}
+
+TEST_F(LazyTest, nested) {
+  const auto e = (lazy::expr(a) * c) - lazy::abs(lazy::expr(b) * c);
+  EXPECT_EQ(lazy::eval(e), (a * c) - abs(b * c));
+}
+
+TEST_F(LazyTest, more_leaves_than_max_fused_arity) {
+  const auto e = (lazy::expr(a) - b) * (lazy::expr(b) + a) / c + a * b / c;
+  static_assert(std::decay_t<decltype(e)>::arity > lazy::max_fused_arity);
+  EXPECT_EQ(lazy::eval(e), (a - b) * (b + a) / c + a * b / c);
+}
+
+TEST_F(LazyTest, unary) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{0.5, 4.0});
+  EXPECT_EQ(lazy::eval(-lazy::expr(a)), -a);
+  EXPECT_EQ(lazy::eval(lazy::abs(lazy::expr(a) - b)), abs(a - b));
+  EXPECT_EQ(lazy::eval(lazy::sqrt(lazy::expr(a) * b)), sqrt(a * b));
+  EXPECT_EQ(lazy::eval(lazy::exp(lazy::expr(x))), exp(x));
+  EXPECT_EQ(lazy::eval(lazy::log(lazy::expr(x) * x)), log(x * x));
+}
+
+TEST_F(LazyTest, trigonometry_rad) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{2}, sc_units::rad,
+                                      Values{0.5, 1.0});
+  EXPECT_EQ(lazy::eval(lazy::sin(lazy::expr(x)) * lazy::cos(lazy::expr(x))),
+            sin(x) * cos(x));
+  EXPECT_EQ(lazy::eval(lazy::tan(lazy::expr(x) + x)), tan(x + x));
+}
+
+TEST_F(LazyTest, trigonometry_deg_falls_back_to_eager) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{2}, sc_units::deg,
+                                      Values{30.0, 90.0});
+  EXPECT_EQ(lazy::eval(lazy::sin(lazy::expr(x))), sin(x));
+  EXPECT_EQ(lazy::eval(lazy::cos(lazy::expr(x) + x)), cos(x + x));
+}
+
+TEST_F(LazyTest, float) {
+  const auto af = astype(a, dtype<float>);
+  const auto bf = astype(b, dtype<float>);
+  const auto result = lazy::eval((lazy::expr(af) - bf) * af);
+  EXPECT_EQ(result.dtype(), dtype<float>);
+  EXPECT_EQ(result, (af - bf) * af);
+}
+
+TEST_F(LazyTest, mixed_dtypes_fall_back_to_eager) {
+  const auto af = astype(a, dtype<float>);
+  const auto i = makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                       Values{1, 2, 3});
+  EXPECT_EQ(lazy::eval((lazy::expr(af) - b) * i), (af - b) * i);
+}
+
+TEST_F(LazyTest, variances) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                      Values{1.0, 2.0, 3.0},
+                                      Variances{0.1, 0.2, 0.3});
+  const auto y = makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                      Values{4.0, 5.0, 6.0},
+                                      Variances{0.4, 0.5, 0.6});
+  const auto expected = (x - y) * a / d;
+  const auto result = lazy::eval((lazy::expr(x) - y) * a / d);
+  EXPECT_TRUE(result.has_variances());
+  const auto rtol = 1e-14 * sc_units::one;
+  const auto close = [&](const Variable &x, const Variable &y) {
+    const auto atol = makeVariable<double>(Values{0.0}, y.unit());
+    return all(isclose(x, y, rtol, atol)).value<bool>();
+  };
+  EXPECT_TRUE(close(values(result), values(expected)));
+  EXPECT_TRUE(close(variances(result), variances(expected)));
+}
+
+TEST_F(LazyTest, correlated_variances_fall_back_to_eager) {
+  const auto x = makeVariable<double>(Values{2.0}, Variances{4.0}, sc_units::m);
+  EXPECT_EQ(lazy::eval(lazy::expr(x) + x), x + x);
+  EXPECT_EQ(lazy::eval(lazy::expr(x) * x), x * x);
+}
+
+TEST_F(LazyTest, bad_variance_broadcast_throws) {
+  const auto x = makeVariable<double>(Values{2.0}, Variances{4.0}, sc_units::m);
+  EXPECT_THROW_DISCARD(lazy::eval(lazy::expr(a) + x), except::VariancesError);
+}
+
+TEST_F(LazyTest, bad_unit_throws_before_computation) {
+  EXPECT_THROW_DISCARD(lazy::eval(lazy::expr(a) + c), except::UnitError);
+  EXPECT_THROW_DISCARD(lazy::eval(lazy::exp(lazy::expr(a))), except::UnitError);
+}
+
+TEST_F(LazyTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 1}, std::pair{1, 3}});
+  const auto binned = make_bins(indices, Dim::X, a);
+  EXPECT_EQ(lazy::eval((lazy::expr(binned) - binned) * c),
+            (binned - binned) * c);
+  EXPECT_EQ(lazy::eval((lazy::expr(binned) * d) / d + binned),
+            binned * d / d + binned);
+}
@@ -2,6 +2,7 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <Eigen/Geometry>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <vector>
 
 #include "fix_typed_test_suite_warnings.h"
@@ -12,6 +13,7 @@
 #include "scipp/variable/except.h"
 #include "scipp/variable/misc_operations.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -976,3 +978,17 @@ TEST(Variable, 6d) {
   copy(a, b);
   a += b;
 }
+
+TEST(Variable, more_dims_than_NDIM_OP_MAX) {
+  const Dimensions dims({Dim("1"), Dim("2"), Dim("3"), Dim("4"), Dim("5"),
+                         Dim("6"), Dim("7"), Dim("8")},
+                        {2, 2, 2, 2, 2, 2, 2, 2});
+  std::vector<double> values(dims.volume());
+  std::iota(values.begin(), values.end(), 0.0);
+  const auto a =
+      makeVariable<double>(dims, sc_units::m, Values(std::move(values)));
+  // Transposed input, such that no dims can be flattened.
+  const auto b = copy(transpose(a));
+  EXPECT_EQ(a + transpose(b), a + a);
+  EXPECT_EQ(copy(transpose(b)), a);
+}
@@ -5,6 +5,7 @@
 #include "scipp/variable/astype.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/rebin.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 #include "test_macros.h"
@@ -63,6 +64,46 @@ TEST(RebinTest, outer) {
   }
 }
 
+class RebinOuterVariancesTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(
+      Dims{Dim::Z, Dim::Y, Dim::X}, Shape{2, 4, 2}, sc_units::counts,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},
+      Variances{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+  Variable oldEdge =
+      makeVariable<double>(Dims{Dim::Y}, Shape{5}, Values{0, 1, 2, 3, 4});
+  Variable newEdge =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{0.0, 1.5, 4.0});
+  // Variances of partially overlapping bins scale with the square of the
+  // overlap fraction.
+  Variable expected = makeVariable<double>(
+      Dims{Dim::Z, Dim::Y, Dim::X}, Shape{2, 2, 2}, sc_units::counts,
+      Values{2.5, 4.0, 13.5, 16.0, 14.5, 16.0, 33.5, 36.0},
+      Variances{1.75, 3.0, 12.75, 15.0, 11.75, 13.0, 30.75, 33.0});
+};
+
+TEST_F(RebinOuterVariancesTest, middle_dim) {
+  EXPECT_EQ(rebin(var, Dim::Y, oldEdge, newEdge), expected);
+}
+
+TEST_F(RebinOuterVariancesTest, float32) {
+  EXPECT_EQ(rebin(astype(var, dtype<float>), Dim::Y, oldEdge, newEdge),
+            astype(expected, dtype<float>));
+}
+
+TEST_F(RebinOuterVariancesTest, sliced_input) {
+  EXPECT_EQ(rebin(var.slice({Dim::X, 1}), Dim::Y, oldEdge, newEdge),
+            expected.slice({Dim::X, 1}));
+  EXPECT_EQ(rebin(var.slice({Dim::Z, 1}), Dim::Y, oldEdge, newEdge),
+            expected.slice({Dim::Z, 1}));
+}
+
+TEST_F(RebinOuterVariancesTest, transposed_input) {
+  const std::vector<Dim> order{Dim::X, Dim::Y, Dim::Z};
+  EXPECT_EQ(rebin(transpose(var, order), Dim::Y, oldEdge, newEdge),
+            transpose(expected, order));
+}
+
 // Code in this test uses a different branch in rebin compared to
 // outer_increasing_2_inner because rebin uses an optimization
 // for stride[rebin_dim] == 1.
@@ -2,7 +2,12 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include "test_macros.h"
+
 #include "scipp/core/eigen.h"
+#include "scipp/core/except.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/string.h"
@@ -39,6 +44,72 @@ TEST_F(SumTest, sum_with_empty_dim) {
       makeVariable<double>(Dims{Dim::X}, Shape{0}, sc_units::m, Values{}));
 }
 
+TEST_F(SumTest, sum_out) {
+  auto out = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{-1.0, -1.0});
+  const auto &result = sum(var, Dim::X, out);
+  EXPECT_EQ(&result, &out);
+  EXPECT_EQ(out, sum(var, Dim::X));
+  // The previous content of `out` is discarded.
+  sum(var, Dim::X, out);
+  EXPECT_EQ(out, sum(var, Dim::X));
+}
+
+TEST_F(SumTest, sum_out_bool) {
+  auto out = makeVariable<int64_t>(Dims{Dim::X}, Shape{2});
+  sum(var_bool, Dim::Y, out);
+  EXPECT_EQ(out, sum(var_bool, Dim::Y));
+}
+
+TEST_F(SumTest, sum_out_bad_output_throws) {
+  auto bad_dims = makeVariable<double>(Dims{Dim::X}, Shape{2});
+  auto bad_dtype = makeVariable<float>(Dims{Dim::Y}, Shape{2});
+  auto bad_variances =
+      makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{}, Variances{});
+  EXPECT_THROW_DISCARD(sum(var, Dim::X, bad_dims), except::DimensionError);
+  EXPECT_THROW_DISCARD(sum(var, Dim::X, bad_dtype), except::TypeError);
+  EXPECT_THROW_DISCARD(sum(var, Dim::X, bad_variances),
+                       except::VariancesError);
+}
+
+TEST_F(SumTest, sum_out_slice_of_input) {
+  const auto expected = sum(var, Dim::X);
+  auto out = var.slice({Dim::X, 0});
+  sum(var, Dim::X, out);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(var, makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                      sc_units::m, Values{3.0, 2.0, 7.0, 4.0}));
+}
+
+TEST_F(SumTest, sum_out_disjoint_slice_of_input_buffer) {
+  // `out` shares the buffer of the input but not its elements.
+  const auto expected = sum(var.slice({Dim::Y, 1}), Dim::X);
+  auto out = var.slice({Dim::Y, 0}).slice({Dim::X, 0});
+  sum(var.slice({Dim::Y, 1}), Dim::X, out);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(var, makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                      sc_units::m, Values{7.0, 2.0, 3.0, 4.0}));
+}
+
+TEST_F(SumTest, sum_out_binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{2}, Values{std::pair{0, 2}, std::pair{2, 4}});
+  const auto buffer =
+      makeVariable<double>(Dims{Dim::Event}, Shape{4}, sc_units::m,
+                           Values{1.0, 2.0, 3.0, 4.0});
+  const auto binned = make_bins(indices, Dim::Event, buffer);
+  auto out = makeVariable<double>(Values{0.0});
+  sum(binned, Dim::X, out);
+  EXPECT_EQ(out, makeVariable<double>(Values{10.0}, sc_units::m));
+}
+
+TEST_F(SumTest, max_min_out) {
+  auto out = makeVariable<double>(Dims{Dim::X}, Shape{2});
+  max(var, Dim::Y, out);
+  EXPECT_EQ(out, max(var, Dim::Y));
+  min(var, Dim::Y, out);
+  EXPECT_EQ(out, min(var, Dim::Y));
+}
+
 TEST(VectorReduceTest, sum_vector) {
   const auto vector_var = makeVariable<Eigen::Vector3d>(
       Dims{Dim::X}, Shape{2}, sc_units::m,
@@ -70,3 +141,35 @@ TEST(SumPrecisionTest, sum_float) {
   EXPECT_EQ(nansum(var, Dim::X),
             makeVariable<float>(Values{init + (N / 2) * 1.0}));
 }
+
+TEST(SumPrecisionTest, sum_pairwise) {
+  // With naive summation all small values would be lost since each is below
+  // half the machine epsilon of the first value.
+  const scipp::index N = 1000000;
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{N + 1});
+  var.values<double>()[0] = 1.0;
+  for (scipp::index i = 1; i <= N; ++i)
+    var.values<double>()[i] = 1e-16;
+  EXPECT_NEAR(sum(var, Dim::X).value<double>(), 1.0 + N * 1e-16, 1e-14);
+  EXPECT_NEAR(sum(fold(var.slice({Dim::X, 1, N + 1}), Dim::X,
+                       {{Dim::Y, Dim::X}, {10, N / 10}}),
+                  Dim::X)
+                  .values<double>()[0],
+              N / 10 * 1e-16, 1e-24);
+}
+
+TEST(SumVariancesTest, sum_variances) {
+  const auto var = makeVariable<double>(
+      Dims{Dim::Y, Dim::X}, Shape{2, 3}, sc_units::m,
+      Values{1.0, 2.0, 3.0, 4.0, 5.0, 6.0},
+      Variances{1.0, 1.0, 2.0, 2.0, 3.0, 3.0});
+  EXPECT_EQ(sum(var, Dim::X),
+            makeVariable<double>(Dims{Dim::Y}, Shape{2}, sc_units::m,
+                                 Values{6.0, 15.0}, Variances{4.0, 8.0}));
+  EXPECT_EQ(sum(var, Dim::Y),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::m,
+                                 Values{5.0, 7.0, 9.0},
+                                 Variances{3.0, 4.0, 5.0}));
+  EXPECT_EQ(sum(astype(var, dtype<float>), Dim::X),
+            astype(sum(var, Dim::X), dtype<float>));
+}
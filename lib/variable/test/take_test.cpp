@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/core/eigen.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/take.h"
+#include "scipp/variable/variable.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class TakeTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                      sc_units::m, Values{1, 2, 3, 4, 5, 6},
+                                      Variances{7, 8, 9, 10, 11, 12});
+  Variable indices =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{4}, Values{2, 0, 0, 1});
+};
+
+TEST_F(TakeTest, inner) {
+  EXPECT_EQ(take(var, indices, Dim::X),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 4},
+                                 sc_units::m, Values{3, 1, 1, 2, 6, 4, 4, 5},
+                                 Variances{9, 7, 7, 8, 12, 10, 10, 11}));
+}
+
+TEST_F(TakeTest, outer) {
+  const auto outer =
+      makeVariable<int64_t>(Dims{Dim::Y}, Shape{3}, Values{1, 1, 0});
+  EXPECT_EQ(take(var, outer, Dim::Y),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 3},
+                                 sc_units::m, Values{4, 5, 6, 4, 5, 6, 1, 2, 3},
+                                 Variances{10, 11, 12, 10, 11, 12, 7, 8, 9}));
+}
+
+TEST_F(TakeTest, transposed) {
+  const auto transposed = transpose(var);
+  EXPECT_EQ(take(transposed, indices, Dim::X),
+            transpose(take(var, indices, Dim::X)));
+}
+
+TEST_F(TakeTest, outer_with_large_slices) {
+  const auto large = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 1000});
+  const auto outer =
+      makeVariable<int64_t>(Dims{Dim::Y}, Shape{4}, Values{2, 0, 2, 1});
+  const auto taken = take(large, outer, Dim::Y);
+  EXPECT_EQ(taken.dims(), Dimensions({Dim::Y, Dim::X}, {4, 1000}));
+  for (scipp::index i = 0; i < 4; ++i)
+    EXPECT_EQ(taken.slice({Dim::Y, i}),
+              large.slice({Dim::Y, outer.values<int64_t>()[i]}));
+}
+
+TEST_F(TakeTest, empty_dim) {
+  for (const auto dim : {Dim::X, Dim::Y}) {
+    const auto empty_var = var.slice({dim, 0, 0});
+    const auto no_indices = makeVariable<int64_t>(Dims{dim}, Shape{0});
+    EXPECT_EQ(take(empty_var, no_indices, dim), empty_var);
+  }
+}
+
+TEST_F(TakeTest, slice) {
+  const auto sliced = var.slice({Dim::Y, 1});
+  EXPECT_EQ(take(sliced, indices, Dim::X),
+            take(var, indices, Dim::X).slice({Dim::Y, 1}));
+}
+
+TEST_F(TakeTest, strings) {
+  const auto strings = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                                 Values{"a", "b", "c"});
+  EXPECT_EQ(take(strings, indices, Dim::X),
+            makeVariable<std::string>(Dims{Dim::X}, Shape{4},
+                                      Values{"c", "a", "a", "b"}));
+}
+
+TEST_F(TakeTest, dtype_without_kernel) {
+  const auto matrices = makeVariable<Eigen::Matrix3d>(
+      Dims{Dim::X}, Shape{3},
+      Values{Eigen::Matrix3d::Identity(), Eigen::Matrix3d::Zero(),
+             Eigen::Matrix3d::Ones()});
+  EXPECT_EQ(take(matrices, indices, Dim::X),
+            makeVariable<Eigen::Matrix3d>(
+                Dims{Dim::X}, Shape{4},
+                Values{Eigen::Matrix3d::Ones(), Eigen::Matrix3d::Identity(),
+                       Eigen::Matrix3d::Identity(), Eigen::Matrix3d::Zero()}));
+}
+
+TEST_F(TakeTest, binned_shares_buffer) {
+  const auto bin_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 3}, std::pair{3, 6}});
+  const auto buffer = makeVariable<double>(Dims{Dim::Event}, Shape{6},
+                                           Values{1, 2, 3, 4, 5, 6});
+  const auto binned = make_bins(bin_indices, Dim::Event, buffer);
+  const auto taken = take(binned, indices, Dim::X);
+  EXPECT_EQ(taken.dims(), Dimensions(Dim::X, 4));
+  EXPECT_EQ(taken.slice({Dim::X, 0}), binned.slice({Dim::X, 2}));
+  EXPECT_EQ(taken.slice({Dim::X, 1}), binned.slice({Dim::X, 0}));
+  EXPECT_EQ(taken.slice({Dim::X, 2}), binned.slice({Dim::X, 0}));
+  EXPECT_EQ(taken.slice({Dim::X, 3}), binned.slice({Dim::X, 1}));
+  EXPECT_EQ(taken.bin_buffer<Variable>().values<double>().data(),
+            binned.bin_buffer<Variable>().values<double>().data());
+}
+
+TEST_F(TakeTest, preserves_alignment) {
+  var.set_aligned(false);
+  EXPECT_FALSE(take(var, indices, Dim::X).is_aligned());
+}
+
+TEST_F(TakeTest, out_of_range_throws) {
+  const auto bad = makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, Values{0, 3});
+  EXPECT_THROW_DISCARD(take(var, bad, Dim::X), except::SliceError);
+  const auto negative =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{1}, Values{-1});
+  EXPECT_THROW_DISCARD(take(var, negative, Dim::X), except::SliceError);
+}
+
+TEST_F(TakeTest, bad_indices_throw) {
+  EXPECT_THROW_DISCARD(
+      take(var, makeVariable<int32_t>(Dims{Dim::X}, Shape{1}, Values{0}),
+           Dim::X),
+      except::TypeError);
+  EXPECT_THROW_DISCARD(take(var,
+                            makeVariable<int64_t>(Dims{Dim::Y, Dim::X},
+                                                  Shape{1, 1}, Values{0}),
+                            Dim::X),
+                       except::DimensionError);
+}
+
+TEST_F(TakeTest, compress) {
+  const auto condition = makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                            Values{true, false, true});
+  EXPECT_EQ(compress(var, condition, Dim::X),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                 sc_units::m, Values{1, 3, 4, 6},
+                                 Variances{7, 9, 10, 12}));
+  EXPECT_EQ(compress(var, makeVariable<bool>(Dims{Dim::X}, Shape{3}), Dim::X),
+            var.slice({Dim::X, 0, 0}));
+}
+
+TEST_F(TakeTest, compress_bad_condition_throws) {
+  const auto condition = makeVariable<bool>(Dims{Dim::Y}, Shape{2},
+                                            Values{true, false});
+  EXPECT_THROW_DISCARD(compress(var, condition, Dim::X),
+                       except::DimensionError);
+  EXPECT_THROW_DISCARD(
+      compress(var, makeVariable<bool>(Dims{Dim::X}, Shape{2}), Dim::X),
+      except::DimensionError);
+  EXPECT_THROW_DISCARD(
+      compress(var, makeVariable<int64_t>(Dims{Dim::X}, Shape{3}), Dim::X),
+      except::TypeError);
+}
+
+TEST(FlatnonzeroTest, basics) {
+  EXPECT_EQ(flatnonzero(makeVariable<bool>(Dims{Dim::X}, Shape{5},
+                                           Values{false, true, true, false,
+                                                  true})),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, Values{1, 2, 4}));
+  EXPECT_EQ(flatnonzero(makeVariable<bool>(Dims{Dim::X}, Shape{0})),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{0}));
+}
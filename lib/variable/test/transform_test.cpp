@@ -11,6 +11,7 @@
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
@@ -433,6 +434,58 @@ TEST(TransformFlagsTest, expect_no_in_variance_if_out_cannot_have_variance) {
   EXPECT_NO_THROW(out = transform(var_no_variance, op_has_flags, name));
 }
 
+namespace {
+template <class T> auto &value_at(const T &ptr, const scipp::index i) {
+  if constexpr (variable::detail::is_ValueAndVariancePointers_v<T>)
+    return ptr.values[i];
+  else
+    return ptr[i];
+}
+template <class T> double variance_at(const T &ptr, const scipp::index i) {
+  if constexpr (variable::detail::is_ValueAndVariancePointers_v<T>)
+    return ptr.variances[i];
+  else
+    return 0.0;
+}
+
+constexpr auto batch_add = overloaded{
+    transform_flags::batch,
+    [](const double a, const double b) { return a + b; },
+    [](const sc_units::Unit &a, const sc_units::Unit &b) { return a + b; },
+    [](const scipp::index n, const std::span<const scipp::index> strides,
+       const auto out, const auto a, const auto b) {
+      for (scipp::index i = 0; i < n; ++i) {
+        value_at(out, i * strides[0]) =
+            value_at(a, i * strides[1]) + value_at(b, i * strides[2]);
+        if constexpr (variable::detail::is_ValueAndVariancePointers_v<
+                          std::decay_t<decltype(out)>>)
+          out.variances[i * strides[0]] =
+              variance_at(a, i * strides[1]) + variance_at(b, i * strides[2]);
+      }
+    }};
+} // namespace
+
+TEST(TransformFlagsTest, batch) {
+  const auto a = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                                      Values{1, 2, 3, 4, 5, 6});
+  const auto b = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{10, 20});
+  EXPECT_EQ(transform<pair_self_t<double>>(a, b, batch_add, name), a + b);
+  EXPECT_EQ(transform<pair_self_t<double>>(transpose(a), b, batch_add, name),
+            transpose(a) + b);
+  EXPECT_EQ(transform<pair_self_t<double>>(b, a, batch_add, name), b + a);
+}
+
+TEST(TransformFlagsTest, batch_variances) {
+  const auto a = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                                      Values{1, 2, 3, 4, 5, 6},
+                                      Variances{1, 2, 3, 4, 5, 6});
+  const auto b = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                                      Values{1, 1, 1, 1, 1, 1});
+  EXPECT_EQ(transform<pair_self_t<double>>(a, b, batch_add, name), a + b);
+  EXPECT_EQ(transform<pair_self_t<double>>(transpose(a), a, batch_add, name),
+            transpose(a) + a);
+}
+
 class TransformBinElementsTest : public ::testing::Test {
 protected:
   Dimensions dims{Dim::Y, 2};
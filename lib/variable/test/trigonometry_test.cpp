@@ -349,6 +349,19 @@ TEST_F(VariableTrigonometryTest, atan2_out_arg) {
   EXPECT_EQ(y, expected);
 }
 
+TEST_F(VariableTrigonometryTest, atan2_out_arg_overlapping_inputs) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, sc_units::rad,
+                                  Values{1.0, 2.0, -1.0});
+  const auto y = var.slice({Dim::X, 0, 2});
+  const auto x = var.slice({Dim::X, 1, 3});
+  const auto expected = atan2(copy(y), copy(x));
+  // `y` partially overlaps with `out`, `x` is identical to `out`.
+  auto out = var.slice({Dim::X, 1, 3});
+  atan2(y, x, out);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(var.slice({Dim::X, 0}), 1.0 * sc_units::rad);
+}
+
 TEST_F(VariableTrigonometryTest, sinc) {
   const auto x =
       makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{-0.5, 1.0, 0.0}, rad);
@@ -341,6 +341,102 @@ TEST(Variable, copy_slice_variance_checks) {
                except::VariancesError);
 }
 
+namespace {
+Variable make_transposed_input() {
+  // Large enough to use the blocked copy kernel.
+  const scipp::index nx = 100;
+  const scipp::index ny = 80;
+  std::vector<double> values(nx * ny);
+  std::vector<double> variances(nx * ny);
+  for (scipp::index i = 0; i < nx * ny; ++i) {
+    values[i] = static_cast<double>(i);
+    variances[i] = static_cast<double>(2 * i);
+  }
+  return transpose(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{ny, nx},
+                                        sc_units::m, Values(values),
+                                        Variances(variances)));
+}
+
+void expect_transposed_copy(const Variable &in, const Variable &out) {
+  EXPECT_EQ(out.unit(), in.unit());
+  const auto nx = in.dims()[Dim::X];
+  const auto ny = in.dims()[Dim::Y];
+  const auto values = out.values<double>();
+  const auto variances = out.variances<double>();
+  const bool x_outer = out.dims().labels()[0] == Dim::X;
+  for (scipp::index x = 0; x < nx; ++x)
+    for (scipp::index y = 0; y < ny; ++y) {
+      const auto i = x_outer ? x * ny + y : y * nx + x;
+      EXPECT_EQ(values[i], static_cast<double>(y * nx + x));
+      EXPECT_EQ(variances[i], static_cast<double>(2 * (y * nx + x)));
+    }
+}
+} // namespace
+
+TEST(Variable, copy_large_transposed) {
+  const auto var = make_transposed_input();
+  const auto result = copy(var);
+  EXPECT_EQ(result.dims(), var.dims());
+  EXPECT_EQ(result, var);
+  expect_transposed_copy(var, result);
+}
+
+TEST(Variable, copy_large_transposed_into_other_dim_order) {
+  const auto var = make_transposed_input();
+  auto out = makeVariable<double>(Dims{Dim::Y, Dim::X},
+                                  Shape{var.dims()[Dim::Y], var.dims()[Dim::X]},
+                                  Values{}, Variances{});
+  copy(var, out);
+  EXPECT_EQ(out, var);
+  expect_transposed_copy(var, out);
+}
+
+TEST(Variable, copy_large_transposed_into_slice) {
+  const auto var = make_transposed_input();
+  auto out = makeVariable<double>(
+      Dims{Dim::X, Dim::Y}, Shape{var.dims()[Dim::X], 2 * var.dims()[Dim::Y]},
+      sc_units::m, Values{}, Variances{});
+  auto slice = out.slice({Dim::Y, 0, var.dims()[Dim::Y]});
+  copy(var, slice);
+  EXPECT_EQ(slice, var);
+}
+
+TEST(Variable, copy_large_transposed_within_buffer) {
+  const auto var = make_transposed_input();
+  const auto nx = var.dims()[Dim::X];
+  const auto ny = var.dims()[Dim::Y];
+  auto buffer = makeVariable<double>(Dims{Dim::Z, Dim::Y, Dim::X},
+                                     Shape{2, ny, nx}, sc_units::m, Values{},
+                                     Variances{});
+  // Source and destination are disjoint parts of the same buffer.
+  copy(var, buffer.slice({Dim::Z, 0}));
+  copy(transpose(buffer.slice({Dim::Z, 0})), buffer.slice({Dim::Z, 1}));
+  EXPECT_EQ(buffer.slice({Dim::Z, 1}), var);
+}
+
+TEST(Variable, copy_transposed_onto_itself) {
+  auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{100, 100});
+  for (scipp::index i = 0; i < 100 * 100; ++i)
+    var.values<double>()[i] = static_cast<double>(i);
+  const auto expected = copy(transpose(var));
+  copy(transpose(var), var);
+  EXPECT_EQ(var, expected);
+}
+
+TEST(Variable, overlaps) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{}, Variances{});
+  const auto a = var.slice({Dim::X, 0, 2});
+  const auto b = var.slice({Dim::X, 2, 4});
+  const auto c = var.slice({Dim::X, 1, 3});
+  EXPECT_FALSE(a.data().overlaps(a, a));
+  EXPECT_FALSE(a.data().overlaps(a, b));
+  EXPECT_TRUE(a.data().overlaps(a, c));
+  EXPECT_TRUE(c.data().overlaps(c, b));
+  EXPECT_FALSE(a.data().overlaps(a, copy(c)));
+  EXPECT_FALSE(a.data().overlaps(a, astype(c, dtype<float>)));
+}
+
 class VariableTest_3d : public ::testing::Test {
 protected:
   const Variable parent{makeVariable<double>(
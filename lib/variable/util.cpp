@@ -122,4 +122,10 @@ Variable as_contiguous(const Variable &var, const Dim dim) {
   return copy(transpose(var, dims.labels()));
 }
 
+/// Return true if `var` has the default (contiguous, row-major) memory layout
+/// for its dims, i.e., it is neither transposed nor a strided slice.
+bool has_default_layout(const Variable &var) {
+  return Strides(var.strides()) == Strides(var.dims());
+}
+
 } // namespace scipp::variable
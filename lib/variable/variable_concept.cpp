@@ -1,8 +1,17 @@
 #include "scipp/variable/variable_concept.h"
 #include "scipp/core/dimensions.h"
+#include "scipp/variable/variable.h"
 
 namespace scipp::variable {
 
 VariableConcept::VariableConcept(const sc_units::Unit &unit) : m_unit(unit) {}
 
+/// Return true if the elements of `a`, which refers to this object, and `b`
+/// partially overlap in memory. Views of identical elements do not overlap.
+///
+/// This default conservatively assumes an overlap if `b` refers to this object.
+bool VariableConcept::overlaps(const Variable &a, const Variable &b) const {
+  return b.is_valid() && &b.data() == &a.data();
+}
+
 } // namespace scipp::variable
@@ -77,6 +77,11 @@ Variable VariableFactory::empty_like(const Variable &prototype,
   return m_makers.at(prototype.dtype())->empty_like(prototype, shape, sizes);
 }
 
+Variable VariableFactory::with_bin_indices(const Variable &prototype,
+                                           const Variable &indices) const {
+  return m_makers.at(prototype.dtype())->with_bin_indices(prototype, indices);
+}
+
 Variable VariableFactory::apply_event_masks(const Variable &var,
                                             const FillValue fill) const {
   return m_makers.at(var.dtype())->apply_event_masks(var, fill);
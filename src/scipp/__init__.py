@@ -169,6 +169,8 @@ from .core import (
 )
 from .core import as_const
 from .core import to
+from .core import memory_pool_info, set_memory_pool
+from .core import max_threads, numa_policy, set_numa_policy, thread_limit
 
 from .logging import display_logs, get_logger
 
@@ -177,7 +179,14 @@ from .reduction import reduce
 del reduction  # type: ignore[name-defined]
 
 # Mainly imported for docs
-from .core import Bins, Coords, GroupByDataset, GroupByDataArray, Masks
+from .core import (
+    Bins,
+    Coords,
+    GroupByDataset,
+    GroupByDataArray,
+    HistogramAccumulator,
+    Masks,
+)
 
 from . import _binding
 
@@ -277,6 +286,7 @@ __all__ = [
     'DimensionError',
     'GroupByDataArray',
     'GroupByDataset',
+    'HistogramAccumulator',
     'Lookup',
     'Masks',
     'Unit',
@@ -374,8 +384,10 @@ __all__ = [
     'make_html',
     'make_svg',
     'max',
+    'max_threads',
     'mean',
     'median',
+    'memory_pool_info',
     'merge',
     'midpoints',
     'min',
@@ -393,6 +405,7 @@ __all__ = [
     'negative',
     'norm',
     'not_equal',
+    'numa_policy',
     'ones',
     'ones_like',
     'plot',
@@ -403,6 +416,8 @@ __all__ = [
     'reduction',
     'round',
     'scalar',
+    'set_memory_pool',
+    'set_numa_policy',
     'show',
     'show_graph',
     'sin',
@@ -420,6 +435,7 @@ __all__ = [
     'table',
     'tan',
     'tanh',
+    'thread_limit',
     'to_dict',
     'to_html',
     'to_unit',
@@ -121,13 +121,42 @@ class Graph:
 
 
 def rule_sequence(rules: Graph) -> list[Rule]:
-    already_used = set()
+    """Return the rules of a graph in the order in which they are evaluated.
+
+    Rules are ordered depth-first starting from the nodes that no other rule
+    depends on. The dependencies of a rule are visited in order of decreasing
+    number of rules needed to compute them (Sethi-Ullman ordering). This
+    minimizes the number of intermediate coords that are alive at the same
+    time, so intermediates that are not kept can be released early.
+    """
+    # Raises CycleError if the graph has cycles.
+    topological = list(rules.nodes_topologically())
+    known = set(rules.nodes())
+    needed: dict[str, set[int]] = {}
+    for node in topological:
+        if node in known:
+            rule = rules[node]
+            needed[node] = {id(rule)}.union(
+                *(needed.get(dep, set()) for dep in rule.dependencies)
+            )
+
+    def by_cost(nodes: Iterable[str]) -> list[str]:
+        return sorted(nodes, key=lambda node: -len(needed.get(node, ())))
+
+    visited = set()
     result = []
-    for rule in (
-        r for n in rules.nodes_topologically() if (r := rules[n]) not in already_used
-    ):
-        already_used.add(rule)
+
+    def visit(node: str) -> None:
+        if node not in known or id(rule := rules[node]) in visited:
+            return
+        visited.add(id(rule))
+        for dep in by_cost(rule.dependencies):
+            visit(dep)
         result.append(rule)
+
+    has_children = {dep for _, rule in rules.items() for dep in rule.dependencies}
+    for node in by_cost(n for n in topological if n not in has_children):
+        visit(node)
     return result
 
 
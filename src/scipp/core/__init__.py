@@ -29,6 +29,7 @@ from .cpp_classes import (
     DType,
     GroupByDataArray,
     GroupByDataset,
+    HistogramAccumulator,
     Masks,
     Unit,
     Variable,
@@ -116,6 +117,8 @@ from .dataset import irreducible_mask
 from .groupby import groupby
 from .hyperbolic import sinh, cosh, tanh, asinh, acosh, atanh
 from .logical import logical_not, logical_and, logical_or, logical_xor
+from .memory_pool import memory_pool_info, set_memory_pool
+from .parallel import max_threads, numa_policy, set_numa_policy, thread_limit
 from .math import (
     abs,
     cross,
@@ -238,6 +241,7 @@ __all__ = [
     'DimensionError',
     'GroupByDataArray',
     'GroupByDataset',
+    'HistogramAccumulator',
     'Lookup',
     'Masks',
     'Unit',
@@ -321,8 +325,10 @@ __all__ = [
     'logspace',
     'lookup',
     'max',
+    'max_threads',
     'mean',
     'median',
+    'memory_pool_info',
     'merge',
     'midpoints',
     'min',
@@ -340,6 +346,7 @@ __all__ = [
     'negative',
     'norm',
     'not_equal',
+    'numa_policy',
     'ones',
     'ones_like',
     'pow',
@@ -347,6 +354,8 @@ __all__ = [
     'reciprocal',
     'round',
     'scalar',
+    'set_memory_pool',
+    'set_numa_policy',
     'sin',
     'sinc',
     'sinh',
@@ -359,6 +368,7 @@ __all__ = [
     'sum',
     'tan',
     'tanh',
+    'thread_limit',
     'to',
     'to_unit',
     'transpose',
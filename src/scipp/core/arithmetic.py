@@ -7,9 +7,12 @@ from __future__ import annotations
 from .._scipp import core as _cpp
 from ..typing import VariableLike, VariableLikeType
 from ._cpp_wrapper_util import call_func as _call_cpp_func
+from .cpp_classes import Variable
 
 
-def add(a: VariableLike, b: VariableLike) -> VariableLike:
+def add(
+    a: VariableLike, b: VariableLike, *, out: Variable | None = None
+) -> VariableLike:
     """Element-wise addition.
 
     Equivalent to::
@@ -22,6 +25,10 @@ def add(a: VariableLike, b: VariableLike) -> VariableLike:
         First summand.
     b :
         Second summand.
+    out :
+        Optional output buffer. Only supported when all arguments are
+        scipp.Variable. Its dims must match the broadcast of the inputs and its
+        dtype determines the dtype of the computation.
 
 
     Returns
@@ -53,10 +60,12 @@ def add(a: VariableLike, b: VariableLike) -> VariableLike:
     general concepts and broadcasting behavior.
     """
 
-    return _call_cpp_func(_cpp.add, a, b)
+    return _call_cpp_func(_cpp.add, a, b, out=out)
 
 
-def divide(dividend: VariableLike, divisor: VariableLike) -> VariableLike:
+def divide(
+    dividend: VariableLike, divisor: VariableLike, *, out: Variable | None = None
+) -> VariableLike:
     """Element-wise true division.
 
     Equivalent to::
@@ -72,6 +81,10 @@ def divide(dividend: VariableLike, divisor: VariableLike) -> VariableLike:
         Dividend of the quotient.
     divisor :
         Divisor of the quotient.
+    out :
+        Optional output buffer. Only supported when all arguments are
+        scipp.Variable. Its dims must match the broadcast of the inputs and its
+        dtype determines the dtype of the computation.
 
     Returns
     -------
@@ -99,7 +112,7 @@ def divide(dividend: VariableLike, divisor: VariableLike) -> VariableLike:
     See the guide on `computation <../../user-guide/computation.rst>`_ for
     general concepts and broadcasting behavior.
     """
-    return _call_cpp_func(_cpp.divide, dividend, divisor)
+    return _call_cpp_func(_cpp.divide, dividend, divisor, out=out)
 
 
 def floor_divide(dividend: VariableLike, divisor: VariableLike) -> VariableLike:
@@ -204,7 +217,9 @@ def mod(dividend: VariableLike, divisor: VariableLike) -> VariableLike:
     return _call_cpp_func(_cpp.mod, dividend, divisor)
 
 
-def multiply(left: VariableLike, right: VariableLike) -> VariableLike:
+def multiply(
+    left: VariableLike, right: VariableLike, *, out: Variable | None = None
+) -> VariableLike:
     """Element-wise product.
 
     Equivalent to::
@@ -220,6 +235,10 @@ def multiply(left: VariableLike, right: VariableLike) -> VariableLike:
         Left factor
     right:
         Right factor.
+    out:
+        Optional output buffer. Only supported when all arguments are
+        scipp.Variable. Its dims must match the broadcast of the inputs and its
+        dtype determines the dtype of the computation.
 
     Returns
     -------
@@ -249,7 +268,7 @@ def multiply(left: VariableLike, right: VariableLike) -> VariableLike:
     See the guide on `computation <../../user-guide/computation.rst>`_ for
     general concepts and broadcasting behavior.
     """
-    return _call_cpp_func(_cpp.multiply, left, right)
+    return _call_cpp_func(_cpp.multiply, left, right, out=out)
 
 
 def negative(a: VariableLikeType) -> VariableLikeType:
@@ -284,7 +303,9 @@ def negative(a: VariableLikeType) -> VariableLikeType:
     return _call_cpp_func(_cpp.negative, a)  # type: ignore[return-value]
 
 
-def subtract(minuend: VariableLike, subtrahend: VariableLike) -> VariableLike:
+def subtract(
+    minuend: VariableLike, subtrahend: VariableLike, *, out: Variable | None = None
+) -> VariableLike:
     """Element-wise difference.
 
     Equivalent to::
@@ -297,6 +318,10 @@ def subtract(minuend: VariableLike, subtrahend: VariableLike) -> VariableLike:
         Minuend.
     subtrahend:
         Subtrahend.
+    out:
+        Optional output buffer. Only supported when all arguments are
+        scipp.Variable. Its dims must match the broadcast of the inputs and its
+        dtype determines the dtype of the computation.
 
     Returns
     -------
@@ -321,4 +346,4 @@ def subtract(minuend: VariableLike, subtrahend: VariableLike) -> VariableLike:
     See the guide on `computation <../../user-guide/computation.rst>`_ for
     general concepts and broadcasting behavior.
     """
-    return _call_cpp_func(_cpp.subtract, minuend, subtrahend)
+    return _call_cpp_func(_cpp.subtract, minuend, subtrahend, out=out)
@@ -1256,6 +1256,108 @@ class Bins(Generic[_O]):
                 out = _call_cpp_func(_cpp.buckets.concatenate, self._obj, other)  # type: ignore[assignment]
             return out
 
+    def extend(self, other: Variable | DataArray) -> None:
+        """Append bin contents of `other` to the bins of this object in-place.
+
+        This accumulates events into existing binned data, e.g., from a stream
+        of event pulses. In contrast to ``concatenate(other, out=...)``, spare
+        capacity is reserved in each bin, so the cost of a call is proportional
+        to the size of `other` in most cases, instead of the total number of
+        events. The spare capacity can be released using :py:meth:`compact`.
+        All objects sharing the bins of this object, such as ``da.data`` of a
+        data array ``da``, see the appended events.
+
+        Parameters
+        ----------
+        other:
+            Other input containing bins. Must not have dimensions that this
+            object does not have.
+
+        Raises
+        ------
+        scipp.DimensionError
+            If `other` has dimensions that this object does not have, or if
+            this object is a slice.
+
+        See Also
+        --------
+        scipp.Bins.compact:
+            Release spare capacity.
+
+        Examples
+        --------
+        Accumulate events of several pulses into a binned array:
+
+          >>> import scipp as sc
+          >>> x_edges = sc.linspace('x', 0.0, 1.0, 3, unit='m')
+          >>> binned = sc.data.table_xyz(30).bin(x=x_edges)
+          >>> for _ in range(3):
+          ...     binned.bins.extend(sc.data.table_xyz(10).bin(x=x_edges))
+          >>> binned.bins.size().sum().value
+          60
+          >>> binned.bins.compact()
+
+        Notes
+        -----
+        Unused parts of the underlying buffer are overwritten, so the buffer must
+        not be shared with other binned objects.
+        """
+        _call_cpp_func(_cpp.buckets.extend, self._obj, other)
+
+    def compact(self) -> None:
+        """Release spare capacity of the underlying buffer in-place.
+
+        Spare capacity is reserved by :py:meth:`extend`. After this call the
+        buffer contains only the contents of the bins.
+
+        See Also
+        --------
+        scipp.Bins.extend:
+            Append bin contents in-place.
+        """
+        _call_cpp_func(_cpp.buckets.compact, self._obj)
+
+    def sort(
+        self, key: str, order: Literal['ascending', 'descending'] = 'ascending'
+    ) -> DataArray:
+        """Sort the contents of every bin based on an event coordinate.
+
+        Events with equal keys keep their original order.
+
+        Parameters
+        ----------
+        key:
+            Name of the event coordinate to sort by.
+        order:
+            Sorting order.
+
+        Returns
+        -------
+        :
+            Binned data with sorted bin contents. The underlying buffer is
+            compacted and contains the bins in order.
+
+        Raises
+        ------
+        KeyError
+            If the events do not have a coordinate named `key`.
+
+        See Also
+        --------
+        scipp.sort:
+            Sort along a dimension.
+
+        Examples
+        --------
+
+          >>> import scipp as sc
+          >>> binned = sc.data.table_xyz(100).bin(x=4)
+          >>> by_y = binned.bins.sort('y')
+          >>> sc.identical(by_y.bins.size(), binned.bins.size())
+          True
+        """
+        return _call_cpp_func(_cpp.buckets.sort, self._obj, key, order)  # type: ignore[return-value]
+
     def _map_constituents_data(self, f: Callable[[_T], _T]) -> _O:
         content = self.constituents
         content['data'] = f(content['data'])  # type: ignore[arg-type]
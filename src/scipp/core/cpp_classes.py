@@ -18,6 +18,7 @@ from .._scipp.core import (
     DTypeError,
     GroupByDataArray,
     GroupByDataset,
+    HistogramAccumulator,
     Masks,
     Unit,
     UnitError,
@@ -51,6 +51,7 @@ __all__ = [
     "DimensionError",
     "GroupByDataArray",
     "GroupByDataset",
+    "HistogramAccumulator",
     "Masks",
     "Unit",
     "UnitError",
@@ -748,6 +749,15 @@ class GroupByDataset:
     def sum(self, dim: str) -> Dataset: ...
 
 
+class HistogramAccumulator:
+    def __init__(self, edges: Variable) -> None: ...
+    def add(self, events: DataArray) -> None: ...
+    def reset(self) -> None: ...
+    def snapshot(self) -> DataArray: ...
+    @property
+    def edges(self) -> Variable: ...
+
+
 class Masks(Mapping[str, Variable]):
     def __contains__(self, arg0: Any) -> bool: ...
     def __copy__(self) -> Masks: ...
@@ -879,6 +889,7 @@ class Variable:
         unit: Union[str, Unit, None, DefaultUnit] = default_unit,
         dtype: Any = None,
         aligned: bool = True,
+        copy: bool = True,
     ) -> None: ...
     def __int__(self) -> int: ...
     def __invert__(self) -> Variable: ...
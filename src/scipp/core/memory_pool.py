@@ -0,0 +1,99 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+
+from typing import Any
+
+from .._scipp import core as _cpp
+
+
+def set_memory_pool(
+    enabled: bool = True,
+    *,
+    thread_cache_limit: int | None = None,
+    largest_class_buffers: int | None = None,
+) -> None:
+    """Configure the memory pool used for array buffers.
+
+    Expressions such as ``a * b + c`` create and drop temporaries of the size of
+    the operands.
+    When the pool is enabled, freed buffers are kept in per-thread caches and
+    reused for subsequent allocations of similar size instead of being returned
+    to the operating system.
+
+    Each thread caches up to ``thread_cache_limit`` bytes or
+    ``largest_class_buffers`` buffers of the largest size allocated so far,
+    whichever is larger.
+    The latter allows for caching the temporaries of expressions on arrays
+    larger than ``thread_cache_limit``.
+
+    Disabling the pool releases all cached buffers.
+
+    Parameters
+    ----------
+    enabled:
+        Whether to allocate buffers via the pool.
+    thread_cache_limit:
+        Minimum number of bytes a single thread may cache.
+        Unchanged if ``None``.
+    largest_class_buffers:
+        Number of buffers of the largest size allocated so far that a single
+        thread may cache. Set to 0 to limit caches to ``thread_cache_limit``.
+        Unchanged if ``None``.
+
+    See also
+    --------
+    scipp.memory_pool_info:
+        Current settings and statistics of the pool.
+
+    Examples
+    --------
+
+      >>> import scipp as sc
+      >>> sc.set_memory_pool(True, thread_cache_limit=2**30)
+      >>> sc.memory_pool_info()['enabled']
+      True
+      >>> sc.set_memory_pool(False)
+    """
+    for name, value in (
+        ('thread_cache_limit', thread_cache_limit),
+        ('largest_class_buffers', largest_class_buffers),
+    ):
+        if value is not None and value < 0:
+            raise ValueError(f"{name} must not be negative, got {value}.")
+    if thread_cache_limit is not None:
+        _cpp._set_memory_pool_thread_cache_limit(thread_cache_limit)
+    if largest_class_buffers is not None:
+        _cpp._set_memory_pool_largest_class_buffers(largest_class_buffers)
+    _cpp._set_memory_pool_enabled(enabled)
+
+
+def memory_pool_info() -> dict[str, Any]:
+    """Return the settings and statistics of the memory pool.
+
+    See :py:func:`scipp.set_memory_pool`.
+
+    Returns
+    -------
+    :
+        Dict with the following items:
+
+        - ``enabled``: Whether the pool is in use.
+        - ``thread_cache_limit``: Minimum number of bytes cached per thread.
+        - ``largest_class_buffers``: Number of buffers of the largest size seen
+          that may be cached per thread.
+        - ``effective_thread_cache_limit``: Current maximum number of bytes
+          cached per thread.
+        - ``hits``: Number of allocations served from a cache.
+        - ``misses``: Number of allocations served by the system allocator.
+        - ``bytes_cached``: Number of bytes currently held in caches.
+        - ``high_water_mark``: Maximum of ``bytes_cached``.
+    """
+    return {
+        'enabled': _cpp._memory_pool_enabled(),
+        'thread_cache_limit': _cpp._memory_pool_thread_cache_limit(),
+        'largest_class_buffers': _cpp._memory_pool_largest_class_buffers(),
+        'effective_thread_cache_limit': (
+            _cpp._memory_pool_effective_thread_cache_limit()
+        ),
+        **_cpp._memory_pool_statistics(),
+    }
@@ -0,0 +1,101 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+
+from collections.abc import Iterator
+from contextlib import contextmanager
+from typing import Literal
+
+from .._scipp import core as _cpp
+
+NumaPolicy = Literal['default', 'first_touch', 'interleave']
+
+
+def max_threads() -> int:
+    """Return the number of threads Scipp may use for parallel operations.
+
+    This reflects the hardware as well as limits set using
+    :py:func:`scipp.thread_limit`.
+
+    Returns
+    -------
+    :
+        The maximum number of threads.
+    """
+    return _cpp.max_threads()  # type: ignore[no-any-return]
+
+
+@contextmanager
+def thread_limit(max_threads: int) -> Iterator[None]:
+    """Limit the number of threads used by Scipp within a context.
+
+    The limit applies only to operations started by the calling thread, other
+    threads are not affected.
+    If limits are nested, the smallest one applies.
+    This is useful to avoid oversubscription when Scipp is called from multiple
+    threads or processes, e.g., by Dask workers.
+
+    Parameters
+    ----------
+    max_threads:
+        Maximum number of threads, must be at least 1.
+
+    Examples
+    --------
+
+      >>> import scipp as sc
+      >>> with sc.thread_limit(1):
+      ...     sc.max_threads()
+      1
+    """
+    limit = _cpp._ThreadLimit(max_threads)
+    try:
+        yield
+    finally:
+        limit.release()
+
+
+def numa_policy() -> NumaPolicy:
+    """Return the placement policy for large buffers on multi-socket machines.
+
+    See :py:func:`scipp.set_numa_policy`.
+
+    Returns
+    -------
+    :
+        The current policy.
+    """
+    return _cpp._numa_policy()  # type: ignore[no-any-return]
+
+
+def set_numa_policy(policy: NumaPolicy) -> None:
+    """Set the placement policy for large buffers on multi-socket machines.
+
+    On machines with more than one NUMA (memory) node, the node holding a page
+    of a buffer determines how fast threads on each socket can access it.
+    The policy applies to buffers of at least 4 MiB allocated after the call:
+
+    - ``'default'``: Leave placement to the operating system.
+      This typically places all pages on the node of the allocating thread.
+    - ``'first_touch'``: Touch pages in parallel when allocating and use the
+      same partition for parallel element-wise operations, such that threads
+      mostly access memory on their own node.
+    - ``'interleave'``: Spread pages round-robin over all nodes.
+
+    On machines with a single memory node all policies behave like
+    ``'default'``.
+
+    Parameters
+    ----------
+    policy:
+        The new policy.
+
+    Examples
+    --------
+
+      >>> import scipp as sc
+      >>> sc.set_numa_policy('first_touch')
+      >>> sc.numa_policy()
+      'first_touch'
+      >>> sc.set_numa_policy('default')
+    """
+    _cpp._set_numa_policy(policy)
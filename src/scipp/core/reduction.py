@@ -28,8 +28,20 @@ from .variable import array
 
 
 def _apply_op(
-    x: VariableLike, dim: Dims, func: Callable[..., VariableLike]
+    x: VariableLike,
+    dim: Dims,
+    func: Callable[..., VariableLike],
+    out: Variable | None = None,
 ) -> VariableLike:
+    if out is not None:
+        if isinstance(x, DataArray | Dataset):
+            raise TypeError("The `out` argument is only supported for variables.")
+        if not isinstance(dim, str):
+            raise ValueError(
+                "The `out` argument requires reducing exactly one dimension, "
+                f"got dim={dim!r}."
+            )
+        return _call_cpp_func(func, x, dim=dim, out=out)
     if dim is None:
         return _call_cpp_func(func, x)
     elif isinstance(dim, str):
@@ -674,7 +686,9 @@ def nanstd(x: VariableLikeType, dim: Dims = None, *, ddof: int) -> VariableLikeT
     )
 
 
-def sum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def sum(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Sum of elements in the input.
 
     If the input data is in single precision (dtype='float32') this internally uses
@@ -690,6 +704,8 @@ def sum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the sum.
         If not given, the sum over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -716,10 +732,12 @@ def sum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.sum(x, 'x')
     <scipp.Variable> (y: 3)      int64  [dimensionless]  [5, 7, 9]
     """
-    return _apply_op(x, dim, _cpp.sum)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.sum, out=out)  # type: ignore[return-value]
 
 
-def nansum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def nansum(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Sum of elements in the input ignoring NaN's.
 
     See :py:func:`scipp.sum` on how rounding errors for float32 inputs are handled.
@@ -731,6 +749,8 @@ def nansum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the sum.
         If not given, the sum over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -750,10 +770,12 @@ def nansum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.nansum(x)
     <scipp.Variable> ()    float64  [dimensionless]  8
     """
-    return _apply_op(x, dim, _cpp.nansum)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.nansum, out=out)  # type: ignore[return-value]
 
 
-def min(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def min(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Minimum of elements in the input.
 
     Warning
@@ -771,6 +793,8 @@ def min(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the min.
         If not given, the min over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -799,10 +823,12 @@ def min(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.min(x, 'y')
     <scipp.Variable> (x: 2)      int64  [dimensionless]  [1, 1]
     """
-    return _apply_op(x, dim, _cpp.min)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.min, out=out)  # type: ignore[return-value]
 
 
-def max(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def max(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Maximum of elements in the input.
 
     Warning
@@ -820,6 +846,8 @@ def max(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the max.
         If not given, the max over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -848,10 +876,12 @@ def max(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.max(x, 'y')
     <scipp.Variable> (x: 2)      int64  [dimensionless]  [4, 9]
     """
-    return _apply_op(x, dim, _cpp.max)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.max, out=out)  # type: ignore[return-value]
 
 
-def nanmin(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def nanmin(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Minimum of elements in the input ignoring NaN's.
 
     Warning
@@ -869,6 +899,8 @@ def nanmin(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the min.
         If not given, the min over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -892,10 +924,12 @@ def nanmin(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.nanmin(x)
     <scipp.Variable> ()    float64  [dimensionless]  1
     """
-    return _apply_op(x, dim, _cpp.nanmin)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.nanmin, out=out)  # type: ignore[return-value]
 
 
-def nanmax(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def nanmax(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Maximum of elements in the input ignoring NaN's.
 
     Warning
@@ -913,6 +947,8 @@ def nanmax(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the max.
         If not given, the max over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -936,10 +972,12 @@ def nanmax(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.nanmax(x)
     <scipp.Variable> ()    float64  [dimensionless]  5
     """
-    return _apply_op(x, dim, _cpp.nanmax)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.nanmax, out=out)  # type: ignore[return-value]
 
 
-def all(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def all(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Logical AND over input values.
 
     Parameters
@@ -949,6 +987,8 @@ def all(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the AND.
         If not given, the AND over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -977,10 +1017,12 @@ def all(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.all(x, 'y')
     <scipp.Variable> (x: 2)       bool        <no unit>  [False, True]
     """
-    return _apply_op(x, dim, _cpp.all)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.all, out=out)  # type: ignore[return-value]
 
 
-def any(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
+def any(
+    x: VariableLikeType, dim: Dims = None, *, out: Variable | None = None
+) -> VariableLikeType:
     """Logical OR over input values.
 
     Parameters
@@ -990,6 +1032,8 @@ def any(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     dim:
         Dimension(s) along which to calculate the OR.
         If not given, the OR over all dimensions is calculated.
+    out:
+        Optional output buffer, only supported for a single ``dim``.
 
     Returns
     -------
@@ -1018,7 +1062,7 @@ def any(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     >>> sc.any(x, 'y')
     <scipp.Variable> (x: 2)       bool        <no unit>  [True, False]
     """
-    return _apply_op(x, dim, _cpp.any)  # type: ignore[return-value]
+    return _apply_op(x, dim, _cpp.any, out=out)  # type: ignore[return-value]
 
 
 # Note: When passing `sc_func`, make sure to disassociate type vars of that function
@@ -460,6 +460,7 @@ def array(
     variances: ArrayLike | None = None,
     unit: Unit | str | DefaultUnit | None = default_unit,
     dtype: DTypeLike | None = None,
+    copy: bool = True,
 ) -> Variable:
     """Constructs a :class:`Variable` with given dimensions, containing given
     values and optional variances.
@@ -479,6 +480,12 @@ def array(
         Unit of contents.
     dtype: scipp.typing.DTypeLike
         Type of underlying data. By default, inferred from `values` argument.
+    copy:
+        If ``False``, the memory of NumPy arrays passed as `values` and
+        `variances` is used directly if possible, instead of making a copy.
+        This requires C-contiguous and aligned arrays which do not need a dtype
+        or unit conversion. The variable then shares memory with the arrays.
+        Arrays that are not writeable are copied when the variable is modified.
 
     Returns
     -------
@@ -521,7 +528,12 @@ def array(
       <scipp.Variable> (x: 3)    float64  [dimensionless]  [1, 2, 3]  [0.1, 0.2, 0.3]
     """
     return _cpp.Variable(  # type: ignore[no-any-return]
-        dims=dims, values=values, variances=variances, unit=unit, dtype=dtype
+        dims=dims,
+        values=values,
+        variances=variances,
+        unit=unit,
+        dtype=dtype,
+        copy=copy,
     )
 
 
@@ -6,18 +6,219 @@ from collections.abc import Callable
 from inspect import signature
 from typing import Any
 
-from ._scipp.core import transform as cpp_transform
-from .core import Unit, Variable
+from ._scipp.core import transform_batch as cpp_transform_batch
+from .core import DType, Unit, Variable
 
 
-def _as_numba_cfunc(function: Any, unit_func: Any = None) -> Any:
+def _batch_call(f: Any, nin: int, variances: bool) -> Any:
+    """Return a function calling ``f`` with the input elements at index ``i``.
+
+    ``a`` and ``v`` are tuples of value and variance arrays of all inputs,
+    ``sa`` and ``sv`` their strides.
+    """
+    if variances:
+        if nin == 1:
+            return lambda i, a, sa, v, sv: f(a[0][i * sa[0]], v[0][i * sv[0]])
+        if nin == 2:
+            return lambda i, a, sa, v, sv: f(
+                a[0][i * sa[0]], v[0][i * sv[0]], a[1][i * sa[1]], v[1][i * sv[1]]
+            )
+        if nin == 3:
+            return lambda i, a, sa, v, sv: f(
+                a[0][i * sa[0]],
+                v[0][i * sv[0]],
+                a[1][i * sa[1]],
+                v[1][i * sv[1]],
+                a[2][i * sa[2]],
+                v[2][i * sv[2]],
+            )
+        return lambda i, a, sa, v, sv: f(
+            a[0][i * sa[0]],
+            v[0][i * sv[0]],
+            a[1][i * sa[1]],
+            v[1][i * sv[1]],
+            a[2][i * sa[2]],
+            v[2][i * sv[2]],
+            a[3][i * sa[3]],
+            v[3][i * sv[3]],
+        )
+    if nin == 1:
+        return lambda i, a, sa, v, sv: f(a[0][i * sa[0]])
+    if nin == 2:
+        return lambda i, a, sa, v, sv: f(a[0][i * sa[0]], a[1][i * sa[1]])
+    if nin == 3:
+        return lambda i, a, sa, v, sv: f(
+            a[0][i * sa[0]], a[1][i * sa[1]], a[2][i * sa[2]]
+        )
+    return lambda i, a, sa, v, sv: f(
+        a[0][i * sa[0]], a[1][i * sa[1]], a[2][i * sa[2]], a[3][i * sa[3]]
+    )
+
+
+def _store_value(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r
+
+
+def _store_values_2(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r[0]
+    o[1][i * so[1]] = r[1]
+
+
+def _store_values_3(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r[0]
+    o[1][i * so[1]] = r[1]
+    o[2][i * so[2]] = r[2]
+
+
+def _store_value_and_variance(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r[0]
+    ov[0][i * sov[0]] = r[1]
+
+
+def _store_values_and_variances_2(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r[0]
+    ov[0][i * sov[0]] = r[1]
+    o[1][i * so[1]] = r[2]
+    ov[1][i * sov[1]] = r[3]
+
+
+def _store_values_and_variances_3(i, r, o, so, ov, sov):  # type: ignore[no-untyped-def]
+    o[0][i * so[0]] = r[0]
+    ov[0][i * sov[0]] = r[1]
+    o[1][i * so[1]] = r[2]
+    ov[1][i * sov[1]] = r[3]
+    o[2][i * so[2]] = r[4]
+    ov[2][i * sov[2]] = r[5]
+
+
+# Functions writing the result of the element function to the outputs, by
+# whether the element function returns variances and by the number of outputs.
+_batch_store = {
+    (False, 1): _store_value,
+    (False, 2): _store_values_2,
+    (False, 3): _store_values_3,
+    (True, 1): _store_value_and_variance,
+    (True, 2): _store_values_and_variances_2,
+    (True, 3): _store_values_and_variances_3,
+}
+
+
+def _as_numba_cfunc(
+    function: Any,
+    unit_func: Any,
+    in_dtype: DType,
+    out_dtype: DType,
+    *,
+    nout: int,
+    variances: bool,
+    in_variances: tuple[bool, ...],
+) -> Any:
+    """Compile a kernel looping over a batch of elements.
+
+    The kernel uses the batch ABI of ``transform_batch``, i.e., it is called once
+    per inner loop of the transform with the number of elements, pointers to the
+    first element of all outputs and inputs, and their strides in elements.
+    Operands with variances contribute a second pointer to their variances.
+    Calling ``function`` inside the compiled loop allows for inlining and
+    vectorization.
+
+    The loop is the same for all kernels. Absent operands and variances are
+    replaced by a single zero with stride 0, such that outputs without variances
+    and inputs without variances can be handled uniformly.
+    """
     import numba
+    import numpy as np
 
-    dtype = 'double'
-    narg = len(signature(function).parameters)
-    cfunc = numba.cfunc(dtype + '(' + ','.join([dtype] * narg) + ')')(function)
+    in_t = np.dtype(str(in_dtype)).type
+    out_t = np.dtype(str(out_dtype)).type
+    out_variances = (
+        variances and any(in_variances) and str(out_dtype) in ('float64', 'float32')
+    )
+    # Index of every stream in the arguments of the kernel, -1 if absent.
+    index = iter(range(2 * (nout + len(in_variances))))
+    o_streams, ov_streams, a_streams, v_streams = [], [], [], []
+    for _ in range(nout):
+        o_streams.append(next(index))
+        ov_streams.append(next(index) if out_variances else -1)
+    for has_variances in in_variances:
+        a_streams.append(next(index))
+        v_streams.append(next(index) if has_variances else -1)
+    o = (*o_streams, *(-1,) * (3 - nout))
+    ov = (*ov_streams, *(-1,) * (3 - nout))
+    a = (*a_streams, *(-1,) * (4 - len(in_variances)))
+    v = (*v_streams, *(-1,) * (4 - len(in_variances)))
+
+    # Strides of contiguous operands, 0 for absent ones.
+    o_unit, ov_unit, a_unit, v_unit = (
+        tuple(int(k >= 0) for k in streams) for streams in (o, ov, a, v)
+    )
+
+    call = numba.njit(_batch_call(numba.njit(function), len(in_variances), variances))
+    store = numba.njit(_batch_store[(variances, nout)])
+
+    @numba.njit
+    def in_stream(n, data, strides, k):  # type: ignore[no-untyped-def]
+        if k < 0:
+            return np.zeros(1, dtype=in_t), 0
+        stream = numba.carray(data[k], ((n - 1) * strides[k] + 1,), dtype=in_t)
+        return stream, strides[k]
+
+    @numba.njit
+    def out_stream(n, data, strides, k):  # type: ignore[no-untyped-def]
+        if k < 0:
+            return np.zeros(1, dtype=out_t), 0
+        stream = numba.carray(data[k], ((n - 1) * strides[k] + 1,), dtype=out_t)
+        return stream, strides[k]
+
+    def loop(n, data, strides):  # type: ignore[no-untyped-def]
+        if n == 0:
+            return
+        o0, so0 = out_stream(n, data, strides, o[0])
+        o1, so1 = out_stream(n, data, strides, o[1])
+        o2, so2 = out_stream(n, data, strides, o[2])
+        ov0, sov0 = out_stream(n, data, strides, ov[0])
+        ov1, sov1 = out_stream(n, data, strides, ov[1])
+        ov2, sov2 = out_stream(n, data, strides, ov[2])
+        a0, sa0 = in_stream(n, data, strides, a[0])
+        a1, sa1 = in_stream(n, data, strides, a[1])
+        a2, sa2 = in_stream(n, data, strides, a[2])
+        a3, sa3 = in_stream(n, data, strides, a[3])
+        v0, sv0 = in_stream(n, data, strides, v[0])
+        v1, sv1 = in_stream(n, data, strides, v[1])
+        v2, sv2 = in_stream(n, data, strides, v[2])
+        v3, sv3 = in_stream(n, data, strides, v[3])
+        outs = (o0, o1, o2)
+        out_strides = (so0, so1, so2)
+        out_vars = (ov0, ov1, ov2)
+        out_var_strides = (sov0, sov1, sov2)
+        ins = (a0, a1, a2, a3)
+        in_strides = (sa0, sa1, sa2, sa3)
+        in_vars = (v0, v1, v2, v3)
+        in_var_strides = (sv0, sv1, sv2, sv3)
+        if (
+            out_strides == o_unit
+            and out_var_strides == ov_unit
+            and in_strides == a_unit
+            and in_var_strides == v_unit
+        ):
+            # Constant strides let the compiler vectorize the loop.
+            for i in range(n):
+                r = call(i, ins, a_unit, in_vars, v_unit)
+                store(i, r, outs, o_unit, out_vars, ov_unit)
+        else:
+            for i in range(n):
+                r = call(i, ins, in_strides, in_vars, in_var_strides)
+                store(i, r, outs, out_strides, out_vars, out_var_strides)
+
+    sig = numba.types.void(
+        numba.types.int64,
+        numba.types.CPointer(numba.types.voidptr),
+        numba.types.CPointer(numba.types.int64),
+    )
+    cfunc = numba.cfunc(sig)(loop)
     cfunc.unit_func = function if unit_func is None else unit_func
     cfunc.name = function.__name__
+    cfunc.variances = variances
     return cfunc
 
 
@@ -26,14 +227,18 @@ def elemwise_func(
     *,
     unit_func: Callable[..., Unit | str | None] | None = None,
     dtype: str = 'float64',
+    out_dtype: str | None = None,
     auto_convert_dtypes: bool = False,
+    nout: int = 1,
+    variances: bool = False,
 ) -> Callable[..., Any]:
     """
     Create a function for transforming input variables based on element-wise operation.
 
     This uses ``numba.cfunc`` to compile a kernel that Scipp can use for transforming
-    the variable contents. Only variables with dtype=float64 are supported. Variances
-    are not supported.
+    the variable contents. The kernel processes contiguous or strided runs of
+    elements at a time, so numba can inline ``func`` and vectorize the loop. All
+    inputs must have the same dtype, one of float64, float32, int64, int32, or bool.
 
     Custom kernels can reduce intermediate memory consumption and improve performance
     in multi-step operations with large input variables.
@@ -42,10 +247,28 @@ def elemwise_func(
     ----------
     func:
         Function to compute an output element from input element values.
+        If ``nout`` is larger than 1, it must return a tuple with one element per
+        output.
     unit_func:
         Function to compute the output unit. If ``None``, ``func`` will be used.
+        If ``nout`` is larger than 1, it must return a tuple with one unit per
+        output. Required if ``variances`` is ``True``.
+    dtype:
+        Dtype that inputs are converted to if ``auto_convert_dtypes`` is ``True``.
+    out_dtype:
+        Dtype of the output. Must be the dtype of the inputs, float64, or bool.
+        Defaults to the dtype of the inputs.
     auto_convert_dtypes:
-        Set to ``True`` to automatically convert all inputs to float64.
+        Set to ``True`` to automatically convert all inputs to ``dtype``.
+    nout:
+        Number of outputs. Transforms with multiple outputs return a tuple of
+        variables. The total number of inputs and outputs may not exceed 4.
+    variances:
+        Set to ``True`` to support variances. ``func`` is then called with the value
+        and the variance of every input, using a variance of 0 for inputs without
+        variances, and must return the value and the variance of every output.
+        Outputs have variances if any input has variances and the output dtype is
+        float64 or float32.
 
     Returns
     -------
@@ -73,16 +296,37 @@ def elemwise_func(
     a potentially large intermediate allocation for the result of "a * b".
     """
 
+    if variances and unit_func is None:
+        raise ValueError('unit_func is required if variances is True.')
+
     def decorator(
         f: Callable[..., object],
     ) -> Callable[[Callable[..., object]], Callable[..., Any]]:
-        cfunc = _as_numba_cfunc(f, unit_func=unit_func)
+        # Kernels are compiled on first use for every combination of dtypes and
+        # inputs with variances, since the latter change the kernel's arguments.
+        kernels: dict[tuple[str, str, tuple[bool, ...]], Any] = {}
 
         @functools.wraps(f)
-        def transform_custom(*args: Variable) -> Variable:
+        def transform_custom(*args: Variable) -> Variable | tuple[Variable, ...]:
             if auto_convert_dtypes:
-                args = tuple(arg.to(dtype='float64', copy=False) for arg in args)
-            return cpp_transform(cfunc, *args)  # type: ignore[no-any-return]
+                args = tuple(arg.to(dtype=dtype, copy=False) for arg in args)
+            in_dtype = args[0].dtype
+            out = in_dtype if out_dtype is None else DType(out_dtype)
+            in_variances = tuple(arg.variances is not None for arg in args)
+            if (key := (str(in_dtype), str(out), in_variances)) not in kernels:
+                kernels[key] = _as_numba_cfunc(
+                    f,
+                    unit_func,
+                    in_dtype,
+                    out,
+                    nout=nout,
+                    variances=variances,
+                    in_variances=in_variances if variances else (False,) * len(args),
+                )
+            result = cpp_transform_batch(kernels[key], out, nout, *args)
+            if nout == 1:
+                return result  # type: ignore[no-any-return]
+            return tuple(result)
 
         return transform_custom  # type: ignore[return-value]
 
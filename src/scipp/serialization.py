@@ -4,29 +4,211 @@
 
 from typing import Any
 
-from .core import DataArray, Dataset, Variable
+import numpy as np
 
+from ._scipp import core as _cpp
+from .core import DataArray, Dataset, DType, Unit, Variable
 
-def serialize(obj: object) -> tuple[dict[str, Any], list[bytes]]:
-    """Serialize Scipp object."""
-    from io import BytesIO
+# Dtypes whose element arrays can be sent as raw buffers. Other dtypes (strings,
+# vectors, nested data arrays, ...) fall back to HDF5.
+_buffer_dtypes = {
+    DType.float64,
+    DType.float32,
+    DType.int64,
+    DType.int32,
+    DType.bool,
+    DType.datetime64,
+}
 
-    from .io.hdf5 import save_hdf5
 
-    header: dict[str, Any] = {}
-    buf = BytesIO()
-    save_hdf5(obj, buf)
-    frames = [buf.getvalue()]
+class _Unsupported(Exception):
+    pass
+
+
+def _add_frame(array: np.ndarray, frames: list[Any]) -> int:
+    # A view of the variable's memory if it is contiguous, i.e., no copy.
+    # Viewed as bytes since not all dtypes (e.g., datetime64) support the buffer
+    # protocol.
+    data = np.ascontiguousarray(array).reshape(-1).view(np.uint8)
+    frames.append(memoryview(data))
+    return len(frames) - 1
+
+
+def _serialize_unit(unit: Unit | None) -> dict[str, Any] | None:
+    if unit is None:
+        return None
+    try:
+        return unit.to_dict()
+    except ValueError:
+        # Units with commodities have no dict representation.
+        raise _Unsupported from None
+
+
+def _deserialize_unit(unit: dict[str, Any] | None) -> Unit | None:
+    return None if unit is None else Unit.from_dict(unit)
+
+
+def _serialize_variable(var: Variable, frames: list[Any]) -> dict[str, Any]:
+    header: dict[str, Any] = {'dims': list(var.dims), 'aligned': var.aligned}
+    if var.bins is not None:
+        # Binned variables are sent as their constituents. The buffer is sent
+        # as is, without copying the content of the bins, unless it is much
+        # larger than the bins, e.g., for a slice or with spare capacity from
+        # `extend`. Same rule as for HDF5.
+        constituents = var.bins.constituents
+        buffer_len = constituents['data'].sizes[constituents['dim']]
+        if buffer_len > 1.5 * var.bins.size().sum().value:
+            var = var.copy()
+            constituents = var.bins.constituents
+        header['type'] = 'binned'
+        header['begin'] = _serialize_variable(constituents['begin'], frames)
+        header['end'] = _serialize_variable(constituents['end'], frames)
+        header['dim'] = constituents['dim']
+        header['data'] = _serialize(constituents['data'], frames)
+        return header
+    if var.dtype not in _buffer_dtypes:
+        raise _Unsupported
+    values = np.asarray(var.values)
+    header['type'] = 'Variable'
+    header['shape'] = list(var.shape)
+    header['unit'] = _serialize_unit(var.unit)
+    header['dtype'] = values.dtype.str
+    header['values'] = _add_frame(values, frames)
+    header['variances'] = (
+        None
+        if var.variances is None
+        else _add_frame(np.asarray(var.variances), frames)
+    )
+    return header
+
+
+def _deserialize_variable(header: dict[str, Any], frames: list[Any]) -> Variable:
+    if header['type'] == 'binned':
+        # The constituents were obtained from a valid binned variable.
+        return _cpp._bins_no_validate(
+            begin=_deserialize_variable(header['begin'], frames),
+            end=_deserialize_variable(header['end'], frames),
+            dim=header['dim'],
+            data=_deserialize(header['data'], frames),
+            aligned=header['aligned'],
+        )
+    dtype = np.dtype(header['dtype'])
+    shape = header['shape']
+
+    def array(index: int | None) -> np.ndarray | None:
+        if index is None:
+            return None
+        return np.frombuffer(frames[index], dtype=dtype).reshape(shape)
+
+    return Variable(
+        dims=header['dims'],
+        values=array(header['values']),
+        variances=array(header['variances']),
+        unit=_deserialize_unit(header['unit']),
+        aligned=header['aligned'],
+    )
+
+
+def _serialize_dict(items: Any, frames: list[Any]) -> dict[str, Any]:
+    return {name: _serialize_variable(var, frames) for name, var in items.items()}
+
+
+def _deserialize_dict(header: dict[str, Any], frames: list[Any]) -> Any:
+    return {
+        name: _deserialize_variable(var, frames) for name, var in header.items()
+    }
+
+
+def _set_alignment(coords: Any, header: dict[str, Any]) -> None:
+    for name, var in header.items():
+        if not var['aligned']:
+            coords.set_aligned(name, False)
+
+
+def _serialize(obj: object, frames: list[Any]) -> dict[str, Any]:
+    if isinstance(obj, Variable):
+        return _serialize_variable(obj, frames)
+    if isinstance(obj, DataArray):
+        return {
+            'type': 'DataArray',
+            'name': obj.name,
+            'data': _serialize_variable(obj.data, frames),
+            'coords': _serialize_dict(obj.coords, frames),
+            'masks': _serialize_dict(obj.masks, frames),
+        }
+    if isinstance(obj, Dataset):
+        return {
+            'type': 'Dataset',
+            'coords': _serialize_dict(obj.coords, frames),
+            'items': {
+                name: {
+                    'data': _serialize_variable(item.data, frames),
+                    'masks': _serialize_dict(item.masks, frames),
+                }
+                for name, item in obj.items()
+            },
+        }
+    raise _Unsupported
+
+
+def _deserialize(header: dict[str, Any], frames: list[Any]) -> object:
+    if header['type'] == 'DataArray':
+        da = DataArray(
+            _deserialize_variable(header['data'], frames),
+            coords=_deserialize_dict(header['coords'], frames),
+            masks=_deserialize_dict(header['masks'], frames),
+            name=header['name'],
+        )
+        _set_alignment(da.coords, header['coords'])
+        return da
+    if header['type'] == 'Dataset':
+        coords = _deserialize_dict(header['coords'], frames)
+        ds = Dataset(
+            {
+                name: DataArray(
+                    _deserialize_variable(item['data'], frames),
+                    masks=_deserialize_dict(item['masks'], frames),
+                )
+                for name, item in header['items'].items()
+            },
+            coords=coords,
+        )
+        _set_alignment(ds.coords, header['coords'])
+        return ds
+    return _deserialize_variable(header, frames)
+
+
+def serialize(obj: object) -> tuple[dict[str, Any], list[Any]]:
+    """Serialize Scipp object.
+
+    Array data of common dtypes is returned as separate frames referencing the
+    memory of the object, without copy if the data is contiguous. Objects
+    containing other dtypes are serialized via HDF5.
+    """
+    frames: list[Any] = []
+    try:
+        header = {'format': 'buffers', 'object': _serialize(obj, frames)}
+    except _Unsupported:
+        from io import BytesIO
+
+        from .io.hdf5 import save_hdf5
+
+        buf = BytesIO()
+        save_hdf5(obj, buf)
+        header = {'format': 'hdf5'}
+        frames = [buf.getvalue()]
     return header, frames
 
 
-def deserialize(header: dict[str, Any], frames: list[bytes]) -> object:
+def deserialize(header: dict[str, Any], frames: list[Any]) -> object:
     """Deserialize Scipp object."""
-    from io import BytesIO
+    if header.get('format', 'hdf5') == 'hdf5':
+        from io import BytesIO
 
-    from .io.hdf5 import load_hdf5
+        from .io.hdf5 import load_hdf5
 
-    return load_hdf5(BytesIO(frames[0]))
+        return load_hdf5(BytesIO(frames[0]))
+    return _deserialize(header['object'], frames)
 
 
 try:
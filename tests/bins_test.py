@@ -637,6 +637,89 @@ def test_bins_concat_gives_same_result_on_transposed() -> None:
     assert sc.identical(da.bins.concat('x'), da.transpose().bins.concat('x'))
 
 
+def test_bins_extend() -> None:
+    edges = sc.linspace('x', 0.0, 1.0, 5, unit='m')
+    pulses = [sc.data.table_xyz(nrow=100 + i).bin(x=edges) for i in range(5)]
+    da = pulses[0].copy()
+    expected = pulses[0]
+    for pulse in pulses[1:]:
+        da.bins.extend(pulse)
+        expected = expected.bins.concatenate(pulse)
+    assert sc.identical(da, expected)
+    da.bins.compact()
+    assert sc.identical(da, expected)
+
+
+def test_bins_extend_variable() -> None:
+    edges = sc.linspace('x', 0.0, 1.0, 5, unit='m')
+    var = sc.data.table_xyz(nrow=100).bin(x=edges).data
+    other = sc.data.table_xyz(nrow=10).bin(x=edges).data
+    expected = var.bins.concatenate(other).bins.concatenate(other)
+    var.bins.extend(other)
+    var.bins.extend(other)
+    assert sc.identical(var, expected)
+
+
+def test_bins_extend_uses_spare_capacity() -> None:
+    edges = sc.linspace('x', 0.0, 1.0, 5, unit='m')
+    da = sc.data.table_xyz(nrow=100).bin(x=edges)
+    da.bins.extend(da.copy())
+    buffer_size = da.bins.constituents['data'].sizes['row']
+    assert buffer_size > 200
+    da.bins.extend(sc.data.table_xyz(nrow=10).bin(x=edges))
+    assert da.bins.constituents['data'].sizes['row'] == buffer_size
+    assert da.bins.size().sum().value == 210
+    da.bins.compact()
+    assert da.bins.constituents['data'].sizes['row'] == 210
+
+
+def test_bins_extend_is_seen_by_aliases() -> None:
+    edges = sc.linspace('x', 0.0, 1.0, 5, unit='m')
+    da = sc.data.table_xyz(nrow=100).bin(x=edges)
+    pulse = sc.data.table_xyz(nrow=10).bin(x=edges)
+    alias = da.data
+    expected = da.bins.concatenate(pulse)
+    # The first call reallocates, the second uses spare capacity.
+    da.data.bins.extend(pulse.data)
+    assert sc.identical(da, expected)
+    assert sc.identical(alias, expected.data)
+    expected = expected.bins.concatenate(pulse)
+    da.data.bins.extend(pulse.data)
+    assert sc.identical(da, expected)
+    assert sc.identical(alias, expected.data)
+
+
+def test_bins_extend_raises_if_other_has_extra_dims() -> None:
+    var = sc.data.table_xyz(nrow=100).bin(x=4).data
+    other = sc.data.table_xyz(nrow=100).bin(x=4, y=2).data
+    with pytest.raises(sc.DimensionError):
+        var.bins.extend(other)
+
+
+@pytest.mark.parametrize('order', ['ascending', 'descending'])
+def test_bins_sort(order: str) -> None:
+    da = sc.data.table_xyz(nrow=1000).bin(x=4, y=3)
+    result = da.bins.sort('z', order=order)
+    assert sc.identical(result.bins.size(), da.bins.size())
+    for i in range(4):
+        for j in range(3):
+            expected = sc.sort(da['x', i]['y', j].values, 'z', order=order)
+            assert sc.identical(result['x', i]['y', j].values, expected)
+
+
+def test_bins_sort_slice() -> None:
+    da = sc.data.table_xyz(nrow=100).bin(x=4)['x', 1:3]
+    result = da.bins.sort('y')
+    assert sc.identical(result.bins.size(), da.bins.size())
+    assert result.bins.constituents['data'].sizes['row'] == da.bins.size().sum().value
+
+
+def test_bins_sort_raises_if_key_not_found() -> None:
+    da = sc.data.table_xyz(nrow=100).bin(x=4)
+    with pytest.raises(KeyError):
+        da.bins.sort('abc')
+
+
 def test_bins_concat_preserves_unrelated_mask() -> None:
     table = sc.data.table_xyz(nrow=100)
     da = table.bin(x=5, y=13)
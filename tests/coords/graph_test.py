@@ -239,3 +239,36 @@ def test_graph_for_graph_3() -> None:
     assert_rule(graph, 'g', ComputeRule, {'d', 'f'})
     assert_rule(graph, 'h', ComputeRule, {'d'})
     assert_rule(graph, 'i', ComputeRule, {'f', 'h'})
+
+
+def test_rule_sequence_evaluates_larger_branch_first() -> None:
+    def ft(short, long):
+        pass
+
+    def flong(mid):
+        pass
+
+    def fmid(a):
+        pass
+
+    def fshort(a):
+        pass
+
+    base_graph = scgraph.Graph({'t': ft, 'long': flong, 'mid': fmid, 'short': fshort})
+    graph = base_graph.graph_for(make_data(('a',)), {'t'})
+    order = [rule.out_names for rule in scgraph.rule_sequence(graph)]
+    # 'short' is computed only once the branch leading to 'long' is done, so
+    # 'mid' can be released before 'short' is computed.
+    assert order == [('a',), ('mid',), ('long',), ('short',), ('t',)]
+
+
+def test_rule_sequence_contains_every_rule_once() -> None:
+    base_graph = graph_3()
+    graph = base_graph.graph_for(make_data(('a', 'e')), {'i', 'g'})
+    sequence = scgraph.rule_sequence(graph)
+    assert len(sequence) == len({id(rule) for rule in sequence})
+    assert {id(graph[node]) for node in graph.nodes()} == {id(r) for r in sequence}
+    produced = set()
+    for rule in sequence:
+        assert set(rule.dependencies) <= produced
+        produced.update(rule.out_names)
@@ -1,8 +1,11 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 # @author Jan-Lukas Wynen
+from collections.abc import Callable
+
 import numpy as np
 import numpy.typing as npt
+import pytest
 
 import scipp as sc
 
@@ -413,3 +416,71 @@ def test_subtract_function() -> None:
 
 def test_negative_function() -> None:
     assert sc.identical(sc.negative(sc.scalar(3)), sc.scalar(-3))
+
+
+@pytest.mark.parametrize(
+    ('func', 'op'),
+    [
+        (sc.add, lambda a, b: a + b),
+        (sc.subtract, lambda a, b: a - b),
+        (sc.multiply, lambda a, b: a * b),
+        (sc.divide, lambda a, b: a / b),
+    ],
+)
+def test_binary_function_out(
+    func: Callable[..., sc.Variable],
+    op: Callable[[sc.Variable, sc.Variable], sc.Variable],
+) -> None:
+    a = sc.array(dims=['y', 'x'], values=[[1.0, 2.0], [3.0, 4.0]], unit='m')
+    b = sc.array(dims=['x'], values=[0.5, 1.5], unit='m')
+    out = sc.empty(sizes={'y': 2, 'x': 2})
+    result = func(a, b, out=out)
+    assert sc.identical(result, out)
+    assert sc.identical(out, op(a, b))
+
+
+def test_binary_function_out_can_alias_input() -> None:
+    a = sc.array(dims=['x'], values=[1.0, 2.0], unit='m')
+    b = sc.array(dims=['x'], values=[10.0, 20.0], unit='m')
+    expected = b - a
+    sc.subtract(b, a, out=a)
+    assert sc.identical(a, expected)
+
+
+def test_binary_function_out_slice() -> None:
+    a = sc.array(dims=['x'], values=[1.0, 2.0])
+    buffer = sc.zeros(sizes={'y': 2, 'x': 2})
+    sc.multiply(a, a, out=buffer['y', 1])
+    assert sc.identical(buffer['y', 1], a * a)
+    assert sc.identical(buffer['y', 0], sc.zeros(sizes={'x': 2}))
+
+
+def test_binary_function_out_with_variances() -> None:
+    a = sc.array(dims=['x'], values=[1.0, 2.0], variances=[0.1, 0.2])
+    b = sc.array(dims=['x'], values=[3.0, 4.0])
+    out = sc.empty(sizes={'x': 2}, with_variances=True)
+    sc.multiply(b, a, out=out)
+    assert sc.identical(out, b * a)
+
+
+def test_binary_function_out_binned() -> None:
+    table = sc.data.table_xyz(100)
+    binned = table.bin(x=4).data
+    scale = sc.arange('x', 1.0, 5.0)
+    out = binned.copy()
+    sc.multiply(binned, scale, out=out)
+    assert sc.identical(out, binned * scale)
+
+
+def test_binary_function_out_bad_output_raises() -> None:
+    a = sc.array(dims=['x'], values=[1.0, 2.0])
+    with pytest.raises(sc.DimensionError):
+        sc.add(a, a, out=sc.empty(sizes={'y': 2}))
+    with pytest.raises(sc.VariancesError):
+        sc.add(a, a, out=sc.empty(sizes={'x': 2}, with_variances=True))
+
+
+def test_binary_function_out_data_array_raises() -> None:
+    da = sc.DataArray(sc.array(dims=['x'], values=[1.0, 2.0]))
+    with pytest.raises(TypeError):
+        sc.add(da, da, out=sc.empty(sizes={'x': 2}))
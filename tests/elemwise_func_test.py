@@ -83,3 +83,147 @@ def test_usable_as_decorator() -> None:
         return a + 1
 
     assert sc.identical(add1(sc.scalar(1.0)), sc.scalar(2.0))
+
+
+@pytest.mark.parametrize('dtype', ['float64', 'float32', 'int64', 'int32'])
+def test_dtypes(dtype: str) -> None:
+    f = sc.elemwise_func(lambda x, y: x * y)
+    a = sc.array(dims=['x'], values=[1, 2, 3], dtype=dtype)
+    b = sc.array(dims=['x'], values=[2, 3, 4], dtype=dtype)
+    assert sc.identical(f(a, b), a * b)
+
+
+def test_bool_out_dtype() -> None:
+    f = sc.elemwise_func(
+        lambda x, y: x < y, out_dtype='bool', unit_func=lambda a, b: None
+    )
+    a = sc.array(dims=['x'], values=[1.0, 4.0], unit=None)
+    b = sc.array(dims=['x'], values=[2.0, 3.0], unit=None)
+    assert sc.identical(f(a, b), a < b)
+
+
+def test_broadcast_and_transpose() -> None:
+    f = sc.elemwise_func(lambda x, y: x - y)
+    a = sc.arange('x', 6.0).fold('x', sizes={'x': 2, 'y': 3})
+    b = sc.array(dims=['y'], values=[1.0, 2.0, 3.0])
+    assert sc.identical(f(a, b), a - b)
+    assert sc.identical(f(a.transpose(), b), a.transpose() - b)
+    assert sc.identical(f(b, a.transpose()), b - a.transpose())
+
+
+def test_raises_on_variances() -> None:
+    f = sc.elemwise_func(lambda x: x + x)
+    var = sc.array(dims=['x'], values=[1.0, 2.0], variances=[1.0, 2.0])
+    with pytest.raises(sc.VariancesError):
+        f(var)
+
+
+def test_variances_require_unit_func() -> None:
+    with pytest.raises(ValueError, match='unit_func'):
+        sc.elemwise_func(lambda x, vx: (x, vx), variances=True)
+
+
+def test_variances() -> None:
+    f = sc.elemwise_func(
+        lambda x, vx, y, vy: (x * y, vx * y * y + vy * x * x),
+        unit_func=lambda a, b: a * b,
+        variances=True,
+    )
+    a = sc.array(dims=['x'], values=[1.0, 2.0], variances=[0.5, 1.0], unit='m')
+    b = sc.array(dims=['x'], values=[3.0, 4.0], variances=[2.0, 3.0], unit='s')
+    assert sc.identical(f(a, b), a * b)
+    assert sc.identical(f(a, b.values * b.unit), a * b.values * b.unit)
+    assert sc.identical(f(a.values * a.unit, b), a.values * a.unit * b)
+
+
+def test_variances_kernel_without_variances() -> None:
+    f = sc.elemwise_func(
+        lambda x, vx: (x + x, 4.0 * vx), unit_func=lambda u: u, variances=True
+    )
+    var = sc.array(dims=['x'], values=[1.0, 2.0])
+    assert sc.identical(f(var), var + var)
+
+
+def test_multiple_outputs() -> None:
+    f = sc.elemwise_func(lambda x, y: (x + y, x - y), nout=2)
+    a = sc.array(dims=['x'], values=[1.0, 2.0], unit='m')
+    b = sc.array(dims=['x'], values=[2.0, 4.0], unit='m')
+    total, diff = f(a, b)
+    assert sc.identical(total, a + b)
+    assert sc.identical(diff, a - b)
+
+
+def test_multiple_outputs_broadcast() -> None:
+    f = sc.elemwise_func(
+        lambda x, y: (x * y, x - y), unit_func=lambda a, b: (a * b, a), nout=2
+    )
+    a = sc.arange('x', 6.0, unit='m').fold('x', sizes={'x': 2, 'y': 3})
+    b = sc.array(dims=['y'], values=[1.0, 2.0, 3.0], unit='m')
+    prod, diff = f(a.transpose(), b)
+    assert sc.identical(prod, a.transpose() * b)
+    assert sc.identical(diff, a.transpose() - b)
+
+
+def test_three_outputs() -> None:
+    f = sc.elemwise_func(lambda x: (x, 2.0 * x, 3.0 * x), nout=3)
+    var = sc.array(dims=['x'], values=[1.0, 2.0], unit='m')
+    a, b, c = f(var)
+    assert sc.identical(a, var)
+    assert sc.identical(b, 2.0 * var)
+    assert sc.identical(c, 3.0 * var)
+
+
+def test_multiple_outputs_with_variances() -> None:
+    f = sc.elemwise_func(
+        lambda x, vx, y, vy: (x + y, vx + vy, x - y, vx + vy),
+        unit_func=lambda a, b: (a, a),
+        nout=2,
+        variances=True,
+    )
+    a = sc.array(dims=['x'], values=[1.0, 2.0], variances=[0.5, 1.0], unit='m')
+    b = sc.array(dims=['x'], values=[2.0, 4.0], variances=[2.0, 3.0], unit='m')
+    total, diff = f(a, b)
+    assert sc.identical(total, a + b)
+    assert sc.identical(diff, a - b)
+
+
+def test_raises_if_too_many_outputs() -> None:
+    f = sc.elemwise_func(
+        lambda x, y, z: (x, y), unit_func=lambda a, b, c: (a, b), nout=2
+    )
+    var = sc.array(dims=['x'], values=[1.0, 2.0])
+    with pytest.raises(TypeError):
+        f(var, var, var)
+
+
+def test_kernel_batch_abi() -> None:
+    import ctypes
+
+    import numpy as np
+
+    from scipp.operations import _as_numba_cfunc
+
+    kernel = _as_numba_cfunc(
+        lambda x, vx, y, vy: (x * y, vx * y * y + vy * x * x),
+        None,
+        sc.DType.float64,
+        sc.DType.float64,
+        nout=1,
+        variances=True,
+        in_variances=(True, False),
+    )
+    x = np.arange(6.0)
+    vx = np.full(6, 0.5)
+    y = np.array([3.0])
+    out = np.zeros(3)
+    out_variances = np.zeros(3)
+    # Output values and variances, x values and variances with stride 2, and y
+    # broadcast with stride 0.
+    data = (ctypes.c_void_p * 5)(
+        *(a.ctypes.data for a in (out, out_variances, x, vx, y))
+    )
+    strides = (ctypes.c_int64 * 5)(1, 1, 2, 2, 0)
+    call = ctypes.CFUNCTYPE(None, ctypes.c_int64, ctypes.c_void_p, ctypes.c_void_p)
+    call(kernel.address)(3, data, strides)
+    np.testing.assert_array_equal(out, [0.0, 6.0, 12.0])
+    np.testing.assert_array_equal(out_variances, [4.5, 4.5, 4.5])
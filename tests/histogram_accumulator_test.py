@@ -0,0 +1,77 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+import threading
+
+import pytest
+
+import scipp as sc
+from scipp.testing import assert_identical
+
+
+def make_edges():
+    return sc.linspace('x', 0.0, 1.0, num=11, unit='m')
+
+
+def test_snapshot_before_add_raises() -> None:
+    acc = sc.HistogramAccumulator(make_edges())
+    with pytest.raises(RuntimeError):
+        acc.snapshot()
+
+
+def test_edges_property() -> None:
+    edges = make_edges()
+    assert_identical(sc.HistogramAccumulator(edges).edges, edges)
+
+
+def test_add_matches_hist_of_concatenated_batches() -> None:
+    edges = make_edges()
+    a = sc.data.table_xyz(100)
+    b = sc.data.table_xyz(50)
+    acc = sc.HistogramAccumulator(edges)
+    acc.add(a)
+    acc.add(b)
+    expected = sc.concat([a, b], 'row').hist(x=edges)
+    assert sc.allclose(acc.snapshot().data, expected.data)
+
+
+def test_add_binned() -> None:
+    edges = make_edges()
+    binned = sc.data.table_xyz(100).bin(y=4)
+    acc = sc.HistogramAccumulator(edges)
+    acc.add(binned)
+    assert sc.allclose(acc.snapshot().data, binned.hist(x=edges).data)
+
+
+def test_reset() -> None:
+    edges = make_edges()
+    table = sc.data.table_xyz(100)
+    acc = sc.HistogramAccumulator(edges)
+    acc.add(table)
+    acc.reset()
+    assert sc.all(acc.snapshot().data == sc.scalar(0.0, unit=table.unit)).value
+    acc.add(table)
+    assert_identical(acc.snapshot(), table.hist(x=edges))
+
+
+def test_snapshot_is_readonly_and_not_modified_by_add() -> None:
+    edges = make_edges()
+    table = sc.data.table_xyz(100)
+    acc = sc.HistogramAccumulator(edges)
+    acc.add(table)
+    snapshot = acc.snapshot()
+    assert not snapshot.values.flags['WRITEABLE']
+    acc.add(table)
+    assert_identical(snapshot, table.hist(x=edges))
+
+
+def test_snapshot_while_adding_from_other_thread() -> None:
+    edges = make_edges()
+    table = sc.data.table_xyz(1000)
+    acc = sc.HistogramAccumulator(edges)
+    acc.add(table)
+    writer = threading.Thread(target=lambda: [acc.add(table) for _ in range(20)])
+    writer.start()
+    while writer.is_alive():
+        assert acc.snapshot().sizes == {'x': 10}
+    writer.join()
+    assert sc.allclose(acc.snapshot().data, 21 * table.hist(x=edges).data)
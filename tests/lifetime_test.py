@@ -174,3 +174,10 @@ def test_lifetime_atan2_out_arg() -> None:
     var = 1.0 * sc.units.one
     var = sc.atan2(y=var, x=var, out=var)
     var *= 1.0  # var would be an invalid view is keep_alive not correct
+
+
+@pytest.mark.parametrize("func", [sc.add, sc.subtract, sc.multiply, sc.divide])
+def test_lifetime_binary_out_arg(func: Callable[..., sc.Variable]) -> None:
+    var = 1.0 * sc.units.one
+    var = func(var, var, out=var)
+    var *= 1.0  # var would be an invalid view is keep_alive not correct
@@ -0,0 +1,61 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+from collections.abc import Iterator
+
+import pytest
+
+import scipp as sc
+
+
+@pytest.fixture
+def pool() -> Iterator[None]:
+    info = sc.memory_pool_info()
+    sc.set_memory_pool(True)
+    try:
+        yield
+    finally:
+        sc.set_memory_pool(
+            info['enabled'],
+            thread_cache_limit=info['thread_cache_limit'],
+            largest_class_buffers=info['largest_class_buffers'],
+        )
+
+
+def test_memory_pool_is_disabled_by_default() -> None:
+    assert not sc.memory_pool_info()['enabled']
+
+
+def test_set_memory_pool_enables_pool(pool: None) -> None:
+    assert sc.memory_pool_info()['enabled']
+
+
+def test_set_memory_pool_sets_limits(pool: None) -> None:
+    sc.set_memory_pool(True, thread_cache_limit=1000, largest_class_buffers=3)
+    info = sc.memory_pool_info()
+    assert info['thread_cache_limit'] == 1000
+    assert info['largest_class_buffers'] == 3
+    assert info['effective_thread_cache_limit'] >= 1000
+
+
+def test_set_memory_pool_rejects_negative_limit(pool: None) -> None:
+    with pytest.raises(ValueError, match='must not be negative'):
+        sc.set_memory_pool(True, thread_cache_limit=-1)
+
+
+def test_memory_pool_reuses_large_temporaries(pool: None) -> None:
+    sc.set_memory_pool(True, thread_cache_limit=0, largest_class_buffers=4)
+    a = sc.arange('x', 2_000_000.0)
+    b = a * 2.0
+    for _ in range(3):
+        c = a * b + a
+    assert sc.identical(c, a * b + a)
+    info = sc.memory_pool_info()
+    assert info['effective_thread_cache_limit'] >= 2_000_000 * 8
+    assert info['hits'] > 0
+
+
+def test_disabling_memory_pool_releases_cache(pool: None) -> None:
+    var = sc.arange('x', 100_000.0)
+    del var
+    sc.set_memory_pool(False)
+    assert sc.memory_pool_info()['bytes_cached'] == 0
@@ -0,0 +1,77 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+import threading
+
+import pytest
+
+import scipp as sc
+
+
+def test_max_threads_is_positive() -> None:
+    assert sc.max_threads() >= 1
+
+
+def test_thread_limit_restores_previous_limit() -> None:
+    before = sc.max_threads()
+    with sc.thread_limit(1):
+        assert sc.max_threads() == 1
+    assert sc.max_threads() == before
+
+
+def test_thread_limit_nested_uses_smallest() -> None:
+    with sc.thread_limit(1):
+        with sc.thread_limit(4):
+            assert sc.max_threads() == 1
+        assert sc.max_threads() == 1
+
+
+def test_thread_limit_restores_limit_on_exception() -> None:
+    before = sc.max_threads()
+    with pytest.raises(RuntimeError):
+        with sc.thread_limit(1):
+            raise RuntimeError
+    assert sc.max_threads() == before
+
+
+def test_thread_limit_does_not_affect_other_threads() -> None:
+    before = sc.max_threads()
+    result = []
+    with sc.thread_limit(1):
+        thread = threading.Thread(target=lambda: result.append(sc.max_threads()))
+        thread.start()
+        thread.join()
+    assert result == [before]
+
+
+def test_thread_limit_rejects_non_positive() -> None:
+    with pytest.raises(ValueError, match='at least 1'):
+        with sc.thread_limit(0):
+            pass
+
+
+def test_operations_give_same_result_with_thread_limit() -> None:
+    var = sc.arange('x', 1_000_000.0).fold('x', sizes={'y': 1000, 'x': 1000})
+    expected = var.sum('y')
+    with sc.thread_limit(1):
+        assert sc.identical(var.sum('y'), expected)
+
+
+def test_numa_policy_defaults_to_default() -> None:
+    assert sc.numa_policy() == 'default'
+
+
+@pytest.mark.parametrize('policy', ['default', 'first_touch', 'interleave'])
+def test_set_numa_policy(policy: sc.core.parallel.NumaPolicy) -> None:
+    try:
+        sc.set_numa_policy(policy)
+        assert sc.numa_policy() == policy
+        var = sc.arange('x', 2_000_000.0)
+        assert sc.identical((var * 2.0).sum(), sc.scalar(3_999_998_000_000.0))
+    finally:
+        sc.set_numa_policy('default')
+
+
+def test_set_numa_policy_rejects_unknown_policy() -> None:
+    with pytest.raises(ValueError, match='Unknown NUMA policy'):
+        sc.set_numa_policy('nearest')  # type: ignore[arg-type]
+    assert sc.numa_policy() == 'default'
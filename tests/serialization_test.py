@@ -1,17 +1,144 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+import numpy as np
 import pytest
 
 import scipp as sc
 from scipp.serialization import deserialize, serialize
 
-_ = pytest.importorskip('h5py')
+
+def roundtrip(obj: object) -> object:
+    return deserialize(*serialize(obj))
 
 
 def test_serialize_roundtrip() -> None:
-    # No detailed testing since this is currently just using HDF5IO internally
     da = sc.data.binned_x(nevent=10, nbin=2)
     ds = sc.Dataset(data={'a': da})
-    assert sc.identical(deserialize(*serialize(da.data)), da.data)
-    assert sc.identical(deserialize(*serialize(da)), da)
-    assert sc.identical(deserialize(*serialize(ds)), ds)
+    assert sc.identical(roundtrip(da.data), da.data)
+    assert sc.identical(roundtrip(da), da)
+    assert sc.identical(roundtrip(ds), ds)
+
+
+@pytest.mark.parametrize(
+    'dtype', ['float64', 'float32', 'int64', 'int32', 'bool', 'datetime64[s]']
+)
+def test_serialize_roundtrip_dtype(dtype: str) -> None:
+    values = np.arange(6).astype(dtype).reshape(2, 3)
+    unit = 's' if dtype == 'datetime64[s]' else None
+    var = sc.array(dims=['x', 'y'], values=values, unit=unit)
+    assert sc.identical(roundtrip(var), var)
+
+
+def test_serialize_roundtrip_variances() -> None:
+    var = sc.array(dims=['x'], values=[1.0, 2.0], variances=[3.0, 4.0], unit='K')
+    assert sc.identical(roundtrip(var), var)
+
+
+def test_serialize_roundtrip_scalar() -> None:
+    var = sc.scalar(1.5, unit=None)
+    assert sc.identical(roundtrip(var), var)
+
+
+def test_serialize_roundtrip_transposed() -> None:
+    var = sc.arange('x', 6.0).fold('x', sizes={'x': 2, 'y': 3}).transpose()
+    assert sc.identical(roundtrip(var), var)
+
+
+def test_serialize_roundtrip_preserves_alignment_and_masks() -> None:
+    da = sc.data.table_xyz(10)
+    da.masks['m'] = da.coords['x'] > sc.scalar(0.5, unit='m')
+    da.coords.set_aligned('y', False)
+    result = roundtrip(da)
+    assert sc.identical(result, da)
+    assert not result.coords['y'].aligned
+    ds = sc.Dataset({'a': da, 'b': 2 * da})
+    ds.coords.set_aligned('x', False)
+    assert sc.identical(roundtrip(ds), ds)
+
+
+def test_serialize_roundtrip_binned_slice() -> None:
+    da = sc.data.binned_xy(nevent=100, nx=4, ny=3)['x', 1:3]
+    assert sc.identical(roundtrip(da), da)
+
+
+def frame_bytes(obj: object) -> int:
+    _, frames = serialize(obj)
+    return sum(memoryview(frame).nbytes for frame in frames)
+
+
+def test_serialize_binned_variable_slice_sends_only_its_events() -> None:
+    var = sc.data.binned_x(nevent=1000, nbin=10).data
+    sliced = var['x', 2:3]
+    result = roundtrip(sliced)
+    assert sc.identical(result, sliced)
+    constituents = result.bins.constituents
+    buffer_len = constituents['data'].sizes[constituents['dim']]
+    assert buffer_len == sliced.bins.size().sum().value
+    assert frame_bytes(sliced) < frame_bytes(var) / 5
+
+
+def test_serialize_roundtrip_preserves_alignment_of_variable() -> None:
+    da = sc.data.table_xyz(10)
+    da.coords.set_aligned('x', False)
+    var = da.coords['x']
+    assert not var.aligned
+    result = roundtrip(var)
+    assert sc.identical(result, var)
+    assert not result.aligned
+    assert roundtrip(sc.arange('x', 3.0)).aligned
+
+
+def test_serialize_does_not_copy_contiguous_data() -> None:
+    var = sc.arange('x', 100.0)
+    _, frames = serialize(var)
+    assert np.shares_memory(np.frombuffer(frames[0], dtype=np.float64), var.values)
+
+
+def test_serialize_falls_back_to_hdf5_for_other_dtypes() -> None:
+    _ = pytest.importorskip('h5py')
+    da = sc.DataArray(
+        sc.array(dims=['x'], values=[1.0, 2.0]),
+        coords={'label': sc.array(dims=['x'], values=['a', 'b'])},
+    )
+    header, _ = serialize(da)
+    assert header['format'] == 'hdf5'
+    assert sc.identical(roundtrip(da), da)
+
+
+def distributed_objects() -> list[object]:
+    da = sc.data.table_xyz(10)
+    da.masks['m'] = da.coords['x'] > sc.scalar(0.5, unit='m')
+    da.coords.set_aligned('y', False)
+    binned = sc.data.binned_xy(nevent=100, nx=4, ny=3)
+    return [
+        sc.arange('x', 6.0, unit='m').fold('x', sizes={'y': 2, 'x': 3}).transpose(),
+        sc.array(dims=['x'], values=[1.0, 2.0], variances=[0.1, 0.2], unit='K'),
+        sc.datetimes(dims=['t'], values=[0, 1], unit='s'),
+        da,
+        sc.Dataset({'a': da, 'b': 2 * da}),
+        binned['x', 1:3],
+        binned.data['y', 1],
+    ]
+
+
+@pytest.mark.parametrize('obj', distributed_objects())
+def test_serialize_roundtrip_distributed_protocol(obj: object) -> None:
+    protocol = pytest.importorskip('distributed.protocol')
+    header, frames = protocol.serialize(obj, serializers=['dask'])
+    assert header['serializer'] == 'dask'
+    assert sc.identical(protocol.deserialize(header, frames), obj)
+    message = protocol.loads(protocol.dumps({'x': protocol.to_serialize(obj)}))
+    assert sc.identical(message['x'], obj)
+
+
+def test_serialize_distributed_protocol_sends_only_events_of_binned_slice() -> None:
+    protocol = pytest.importorskip('distributed.protocol')
+    da = sc.data.binned_x(nevent=1000, nbin=10)
+    da.coords.set_aligned('x', False)
+    sliced = da['x', 2:3]
+    result = protocol.loads(protocol.dumps({'x': protocol.to_serialize(sliced)}))['x']
+    assert sc.identical(result, sliced)
+    assert not result.coords['x'].aligned
+    constituents = result.bins.constituents
+    buffer_len = constituents['data'].sizes[constituents['dim']]
+    assert buffer_len == sliced.bins.size().sum().value
@@ -78,6 +78,14 @@ def test_all_false_gives_empty_slice(
     assert sc.identical(sliceable[condition], sliceable['xx', 0:0])
 
 
+def test_empty_condition_on_empty_dim_gives_empty_slice(
+    sliceable: sc.Variable | sc.DataArray | sc.Dataset,
+) -> None:
+    empty = sliceable['xx', 0:0]
+    condition = sc.array(dims=['xx'], values=[], dtype=bool)
+    assert sc.identical(empty[condition], empty)
+
+
 def test_all_true_gives_copy(
     sliceable: sc.Variable | sc.DataArray | sc.Dataset,
 ) -> None:
@@ -138,3 +138,30 @@ def test_out_of_range_index_raises_IndexError(pos: int) -> None:
     var = sc.arange('xx', 4)
     with pytest.raises(IndexError):
         var['xx', [pos]]
+
+
+def test_binned_data_gives_copy_of_selected_bins() -> None:
+    da = sc.data.table_xyz(100).bin(x=4).drop_coords('x')
+    original = da.copy()
+    sliced = da['x', [2, 0, 2]]
+    assert sc.identical(
+        sliced,
+        sc.concat([da['x', 2], da['x', 0], da['x', 2]], 'x'),  # type: ignore[type-var]
+    )
+    sliced.bins.data *= 2  # type: ignore[union-attr]
+    assert sc.identical(da, original)
+
+
+def test_variances_are_gathered() -> None:
+    var = sc.array(dims=['xx'], values=[1.0, 2.0, 3.0], variances=[4.0, 5.0, 6.0])
+    assert sc.identical(
+        var['xx', [2, 0]],
+        sc.array(dims=['xx'], values=[3.0, 1.0], variances=[6.0, 4.0]),
+    )
+
+
+def test_empty_list_on_empty_dim_gives_empty_slice(
+    sliceable: sc.Variable | sc.DataArray | sc.Dataset,
+) -> None:
+    empty = sliceable['xx', 0:0]
+    assert sc.identical(empty['xx', []], empty)
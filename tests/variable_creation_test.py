@@ -1,6 +1,8 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 # @author Simon Heybrock
+import time
+import weakref
 from collections.abc import Callable, Sequence
 from typing import Any
 
@@ -533,6 +535,85 @@ def test_array_nd_high_dim_sliced_end_c_layout(ndim: int) -> None:
     np.testing.assert_array_equal(var.values, values)
 
 
+@pytest.mark.parametrize('dtype', ['float64', 'float32', 'int64', 'int32', 'bool'])
+def test_array_copy_false_shares_memory(dtype: str) -> None:
+    values = np.arange(6).astype(dtype).reshape(2, 3)
+    var = sc.array(dims=['x', 'y'], values=values, copy=False)
+    assert np.shares_memory(var.values, values)
+    values[0, 0] = 1
+    assert var.values[0, 0] == values[0, 0]
+
+
+def test_array_copy_false_shares_memory_of_variances() -> None:
+    values = np.arange(3.0)
+    variances = np.arange(3.0)
+    var = sc.array(dims=['x'], values=values, variances=variances, copy=False)
+    assert np.shares_memory(var.values, values)
+    assert np.shares_memory(var.variances, variances)
+
+
+def test_array_copy_false_keeps_array_alive() -> None:
+    var = sc.array(dims=['x'], values=np.arange(1000.0), copy=False)
+    np.testing.assert_array_equal(var.values, np.arange(1000.0))
+
+
+def test_array_copy_true_does_not_share_memory() -> None:
+    values = np.arange(3.0)
+    var = sc.array(dims=['x'], values=values)
+    assert not np.shares_memory(var.values, values)
+
+
+@pytest.mark.parametrize(
+    'values',
+    [
+        np.arange(6.0).reshape(2, 3).T,
+        np.arange(6.0)[::2],
+        np.arange(3.0).astype('>f8'),
+        np.arange(3),
+    ],
+    ids=['transposed', 'strided', 'byteswapped', 'needs_conversion'],
+)
+def test_array_copy_false_copies_if_required(values: npt.NDArray[Any]) -> None:
+    dims = ['x', 'y'][: values.ndim]
+    var = sc.array(dims=dims, values=values, dtype='float64', copy=False)
+    assert not np.shares_memory(var.values, values)
+    np.testing.assert_array_equal(var.values, values)
+
+
+def test_array_copy_false_copies_if_unit_conversion_required() -> None:
+    values = np.array([1, 2], dtype='datetime64[s]')
+    var = sc.array(dims=['x'], values=values, unit='ms', copy=False)
+    assert not np.shares_memory(var.values, values)
+
+
+def test_array_copy_false_copies_readonly_array() -> None:
+    values = np.arange(3.0)
+    values.flags.writeable = False
+    var = sc.array(dims=['x'], values=values, copy=False)
+    alias = var['x', :]
+    assert not np.shares_memory(var.values, values)
+    assert var.values.flags.writeable
+    var *= 2.0
+    np.testing.assert_array_equal(values, [0.0, 1.0, 2.0])
+    np.testing.assert_array_equal(var.values, [0.0, 2.0, 4.0])
+    np.testing.assert_array_equal(alias.values, [0.0, 2.0, 4.0])
+
+
+def test_array_copy_false_releases_array_without_gil() -> None:
+    values = np.arange(3.0)
+    ref = weakref.ref(values)
+    ds = sc.Dataset({'a': sc.array(dims=['x'], values=values, copy=False)})
+    del values
+    assert ref() is not None
+    # Deleting releases the GIL, the array is released later by the main thread.
+    del ds['a']
+    for _ in range(100):
+        if ref() is None:
+            break
+        time.sleep(0.001)
+    assert ref() is None
+
+
 def test_zeros_like() -> None:
     var = sc.Variable(dims=['x', 'y', 'z'], values=np.random.random([1, 2, 3]))
     expected = sc.zeros(dims=['x', 'y', 'z'], shape=[1, 2, 3])
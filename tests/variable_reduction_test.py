@@ -3,6 +3,7 @@
 # @file
 # @author Simon Heybrock
 import numpy as np
+import pytest
 
 import scipp as sc
 
@@ -88,3 +89,42 @@ def test_sum_multiple_dims() -> None:
     assert sc.identical(var.sum(()), var)
     assert sc.identical(var.sum(('x',)), var.sum('x'))
     assert sc.identical(var.sum(('x', 'y', 'z')), var.sum())
+
+
+def test_sum_out() -> None:
+    var = sc.array(dims=['x', 'y'], values=np.arange(4.0).reshape(2, 2), unit='m')
+    out = sc.empty(sizes={'y': 2})
+    result = sc.sum(var, 'x', out=out)
+    assert sc.identical(result, out)
+    assert sc.identical(out, sc.array(dims=['y'], values=[2.0, 4.0], unit='m'))
+
+
+def test_reduction_out_overwrites_previous_content() -> None:
+    var = sc.array(dims=['x', 'y'], values=[[1, 5], [3, 2]])
+    out = sc.zeros(sizes={'y': 2}, dtype='int64')
+    sc.max(var, 'x', out=out)
+    assert sc.identical(out, sc.array(dims=['y'], values=[3, 5]))
+    sc.min(var, 'x', out=out)
+    assert sc.identical(out, sc.array(dims=['y'], values=[1, 2]))
+
+
+def test_sum_out_requires_single_dim() -> None:
+    var = sc.array(dims=['x', 'y'], values=np.arange(4.0).reshape(2, 2))
+    with pytest.raises(ValueError, match='exactly one dimension'):
+        sc.sum(var, out=sc.scalar(0.0))
+    with pytest.raises(ValueError, match='exactly one dimension'):
+        sc.sum(var, ('x', 'y'), out=sc.scalar(0.0))
+
+
+def test_sum_out_bad_output_raises() -> None:
+    var = sc.array(dims=['x', 'y'], values=np.arange(4.0).reshape(2, 2))
+    with pytest.raises(sc.DimensionError):
+        sc.sum(var, 'x', out=sc.empty(sizes={'x': 2}))
+    with pytest.raises(sc.DTypeError):
+        sc.sum(var, 'x', out=sc.empty(sizes={'y': 2}, dtype='float32'))
+
+
+def test_sum_out_data_array_raises() -> None:
+    da = sc.DataArray(sc.array(dims=['x'], values=[1.0, 2.0]))
+    with pytest.raises(TypeError, match='only supported for variables'):
+        sc.sum(da, 'x', out=sc.scalar(0.0))